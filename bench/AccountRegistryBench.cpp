@@ -0,0 +1,54 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "AccountRegistry.h"
+#include "HexCoding.h"
+
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+
+using namespace Binance;
+
+static const auto privateKey = parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9");
+static auto account = std::make_shared<Account>(privateKey, 1, 0);
+
+// All threads reserve sequence numbers for the same account.
+static void BM_AccountNextSequence(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(account->nextSequence());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AccountNextSequence)->ThreadRange(1, 64)->UseRealTime();
+
+static std::mutex mutex;
+static int64_t sequence = 0;
+
+// Baseline: a mutex-protected counter, as callers had to do before.
+static void BM_MutexNextSequence(benchmark::State& state) {
+    for (auto _ : state) {
+        std::lock_guard<std::mutex> lock(mutex);
+        benchmark::DoNotOptimize(sequence++);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MutexNextSequence)->ThreadRange(1, 64)->UseRealTime();
+
+static AccountRegistry registry;
+
+// Looking the account up on every reservation instead of keeping the handle.
+static void BM_AccountRegistryFind(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        registry.add("main", privateKey, 1, 0);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(registry.find("main")->nextSequence());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AccountRegistryFind)->ThreadRange(1, 64)->UseRealTime();
@@ -0,0 +1,110 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Address.h"
+#include "AllocationCounter.h"
+#include "Arena.h"
+#include "Bech32.h"
+#include "HexCoding.h"
+#include "Signer.h"
+
+#ifndef BINANCE_NO_PROTOBUF
+#include "dex.pb.h"
+#endif
+
+#include <benchmark/benchmark.h>
+
+using namespace Binance;
+
+static const auto keyhash = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+
+/// Reports heap allocations and bytes per iteration next to the timings.
+static void reportAllocations(benchmark::State& state, const AllocationCounter& counter) {
+    const auto iterations = static_cast<double>(state.iterations());
+    state.counters["allocs"] = counter.allocations() / iterations;
+    state.counters["bytes"] = counter.bytes() / iterations;
+}
+
+#ifndef BINANCE_NO_PROTOBUF
+static void BM_AllocationsSignerBuild(benchmark::State& state) {
+    auto order = NewOrder();
+    order.set_sender(keyhash.data(), keyhash.size());
+    order.set_id("B6561DCC104130059A7C08F48C64610C1F6F9064-11");
+    order.set_symbol("BTC-5C4_BNB");
+    order.set_ordertype(2);
+    order.set_side(1);
+    order.set_price(100000000);
+    order.set_quantity(1200000000);
+    order.set_timeinforce(1);
+    auto signer = Signer(order);
+    signer.accountNumber = 1;
+    signer.sequence = 10;
+    signer.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
+
+    auto counter = AllocationCounter();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(signer.build());
+    }
+    reportAllocations(state, counter);
+}
+BENCHMARK(BM_AllocationsSignerBuild);
+
+static void BM_AllocationsSignerBuildArena(benchmark::State& state) {
+    auto order = NewOrder();
+    order.set_sender(keyhash.data(), keyhash.size());
+    order.set_id("B6561DCC104130059A7C08F48C64610C1F6F9064-11");
+    order.set_symbol("BTC-5C4_BNB");
+    order.set_ordertype(2);
+    order.set_side(1);
+    order.set_price(100000000);
+    order.set_quantity(1200000000);
+    order.set_timeinforce(1);
+    auto signer = Signer(order);
+    signer.accountNumber = 1;
+    signer.sequence = 10;
+    signer.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
+
+    Arena arena;
+    auto counter = AllocationCounter();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(signer.build(arena).data());
+        arena.reset();
+    }
+    reportAllocations(state, counter);
+}
+BENCHMARK(BM_AllocationsSignerBuildArena);
+#endif
+
+static void BM_AllocationsAddressEncode(benchmark::State& state) {
+    const auto address = Address(Address::binanceHRP, keyhash);
+    auto counter = AllocationCounter();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(address.encode());
+    }
+    reportAllocations(state, counter);
+}
+BENCHMARK(BM_AllocationsAddressEncode);
+
+static void BM_AllocationsBech32Decode(benchmark::State& state) {
+    const auto encoded = Address(Address::binanceHRP, keyhash).encode();
+    auto counter = AllocationCounter();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Bech32::decode(encoded));
+    }
+    reportAllocations(state, counter);
+}
+BENCHMARK(BM_AllocationsBech32Decode);
+
+static void BM_AllocationsParseHex(benchmark::State& state) {
+    const auto text = hex(keyhash);
+    auto counter = AllocationCounter();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parse_hex(text));
+    }
+    reportAllocations(state, counter);
+}
+BENCHMARK(BM_AllocationsParseHex);
@@ -0,0 +1,156 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HexCoding.h"
+
+#include "crypto/bignum.h"
+#include "crypto/ecdsa.h"
+#include "crypto/hmac.h"
+#include "crypto/ripemd160.h"
+#include "crypto/secp256k1.h"
+#include "crypto/sha2.h"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace Binance;
+
+static const auto privateKey = parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9");
+static const auto digest = parse_hex("e2a4baff6f60ddfd8f4aec2bb5e9d3e1cfbc3cf1dd3ea1dcaf4e7d23a3d0a9a2");
+
+static void BM_EcdsaSignDigest(benchmark::State& state) {
+    uint8_t signature[64];
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ecdsa_sign_digest(&secp256k1, privateKey.data(), digest.data(), signature, nullptr, nullptr));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EcdsaSignDigest);
+
+static void BM_ScalarMultiply(benchmark::State& state) {
+    bignum256 k;
+    bn_read_be(privateKey.data(), &k);
+    curve_point point;
+    for (auto _ : state) {
+        scalar_multiply(&secp256k1, &k, &point);
+        benchmark::DoNotOptimize(point);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ScalarMultiply);
+
+static void BM_PointMultiply(benchmark::State& state) {
+    bignum256 k;
+    bn_read_be(digest.data(), &k);
+    bn_mod(&k, &secp256k1.order);
+    curve_point point;
+    for (auto _ : state) {
+        point_multiply(&secp256k1, &k, &secp256k1.G, &point);
+        benchmark::DoNotOptimize(point);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PointMultiply);
+
+static const auto counterpartyKey = parse_hex("026a35920088d98c3888ca68c53dfc93f4564602606cbb87f0fe5ee533db38e502");
+
+static void BM_EcdhMultiply(benchmark::State& state) {
+    uint8_t session[65];
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ecdh_multiply(&secp256k1, privateKey.data(), counterpartyKey.data(), session));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EcdhMultiply);
+
+static void BM_EcdhMultiplyX(benchmark::State& state) {
+    uint8_t sessionX[32];
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ecdh_multiply_x(&secp256k1, privateKey.data(), counterpartyKey.data(), sessionX));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EcdhMultiplyX);
+
+static void BM_EcdhMultiplyXBatch(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    Data publicKeys;
+    for (size_t i = 0; i < count; i += 1) {
+        publicKeys.insert(publicKeys.end(), counterpartyKey.begin(), counterpartyKey.end());
+    }
+    Data sessionXs(32 * count);
+    std::vector<int> results(count);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ecdh_multiply_x_batch(&secp256k1, privateKey.data(), publicKeys.data(), count, sessionXs.data(), results.data()));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_EcdhMultiplyXBatch)->Arg(64);
+
+static void BM_BignumInverse(benchmark::State& state) {
+    bignum256 x;
+    bn_read_be(digest.data(), &x);
+    for (auto _ : state) {
+        auto y = x;
+        bn_inverse(&y, &secp256k1.prime);
+        benchmark::DoNotOptimize(y);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BignumInverse);
+
+static void BM_BignumMultiply(benchmark::State& state) {
+    bignum256 x, y;
+    bn_read_be(digest.data(), &x);
+    bn_read_be(privateKey.data(), &y);
+    bn_mod(&y, &secp256k1.prime);
+    for (auto _ : state) {
+        bn_multiply(&x, &y, &secp256k1.prime);
+        benchmark::DoNotOptimize(y);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BignumMultiply);
+
+// Message sizes from a digest to a large transaction.
+static void messageSizes(benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(8)->Range(32, 16 << 10);
+}
+
+static void BM_Sha256(benchmark::State& state) {
+    const Data message(state.range(0), 0xA5);
+    uint8_t hash[SHA256_DIGEST_LENGTH];
+    for (auto _ : state) {
+        sha256_Raw(message.data(), message.size(), hash);
+        benchmark::DoNotOptimize(hash);
+    }
+    state.SetBytesProcessed(state.iterations() * message.size());
+}
+BENCHMARK(BM_Sha256)->Apply(messageSizes);
+
+static void BM_Ripemd160(benchmark::State& state) {
+    const Data message(state.range(0), 0xA5);
+    uint8_t hash[RIPEMD160_DIGEST_LENGTH];
+    for (auto _ : state) {
+        ripemd160(message.data(), static_cast<uint32_t>(message.size()), hash);
+        benchmark::DoNotOptimize(hash);
+    }
+    state.SetBytesProcessed(state.iterations() * message.size());
+}
+BENCHMARK(BM_Ripemd160)->Apply(messageSizes);
+
+static void BM_HmacSha256(benchmark::State& state) {
+    const Data message(state.range(0), 0xA5);
+    uint8_t hash[SHA256_DIGEST_LENGTH];
+    for (auto _ : state) {
+        hmac_sha256(privateKey.data(), static_cast<uint32_t>(privateKey.size()), message.data(), static_cast<uint32_t>(message.size()), hash);
+        benchmark::DoNotOptimize(hash);
+    }
+    state.SetBytesProcessed(state.iterations() * message.size());
+}
+BENCHMARK(BM_HmacSha256)->Apply(messageSizes);
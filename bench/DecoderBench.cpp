@@ -0,0 +1,75 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Decoder.h"
+#include "HexCoding.h"
+#include "TransactionBuilder.h"
+
+#include "dex.pb.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace Binance;
+
+static Data makeTransaction(size_t count) {
+    auto keyhash = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+    auto builder = TransactionBuilder();
+    builder.accountNumber = 1;
+    builder.sequence = 10;
+    builder.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
+    std::vector<NewOrder> orders(count);
+    for (size_t i = 0; i < count; i += 1) {
+        auto& order = orders[i];
+        order.set_sender(keyhash.data(), keyhash.size());
+        order.set_id("B6561DCC104130059A7C08F48C64610C1F6F9064-" + std::to_string(i));
+        order.set_symbol("BTC-5C4_BNB");
+        order.set_ordertype(2);
+        order.set_side(1);
+        order.set_price(100000000);
+        order.set_quantity(1200000000);
+        order.set_timeinforce(1);
+        builder.add(order);
+    }
+    return builder.build();
+}
+
+// Baseline: protobuf parsing of the transaction and every message, copying all bytes fields.
+static void BM_ProtobufDecode(benchmark::State& state) {
+    const auto transaction = makeTransaction(state.range(0));
+    for (auto _ : state) {
+        auto decoded = Transaction();
+        decoded.ParseFromArray(transaction.data() + 2 + 4, static_cast<int>(transaction.size() - 2 - 4));
+        for (const auto& msg : decoded.msgs()) {
+            auto order = NewOrder();
+            order.ParseFromArray(msg.data() + 4, static_cast<int>(msg.size() - 4));
+            benchmark::DoNotOptimize(order.price());
+        }
+        auto signature = Signature();
+        signature.ParseFromString(decoded.signatures(0));
+        benchmark::DoNotOptimize(signature.sequence());
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * transaction.size());
+}
+BENCHMARK(BM_ProtobufDecode)->Arg(1)->Arg(8)->Arg(128);
+
+static void BM_AminoDecode(benchmark::State& state) {
+    const auto transaction = makeTransaction(state.range(0));
+    for (auto _ : state) {
+        Amino::TransactionView view;
+        Amino::decodeTransaction(transaction, view);
+        for (const auto& msg : view.msgs) {
+            Amino::NewOrderView order;
+            Amino::NewOrderView::decode(msg.body, order);
+            benchmark::DoNotOptimize(order.price);
+        }
+        benchmark::DoNotOptimize(view.signatures.begin()->sequence);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * transaction.size());
+}
+BENCHMARK(BM_AminoDecode)->Arg(1)->Arg(8)->Arg(128);
@@ -0,0 +1,75 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Address.h"
+#include "Amino.h"
+#include "Bech32.h"
+#include "HexCoding.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace Binance;
+
+static const auto keyhash = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+
+static void BM_Bech32Encode(benchmark::State& state) {
+    Data values;
+    Bech32::convertBits<8, 5, true>(values, keyhash);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Bech32::encode("bnb", values));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Bech32Encode);
+
+static void BM_Bech32Decode(benchmark::State& state) {
+    Data values;
+    Bech32::convertBits<8, 5, true>(values, keyhash);
+    const auto address = Bech32::encode("bnb", values);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Bech32::decode(address));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Bech32Decode);
+
+static void BM_AddressDecode(benchmark::State& state) {
+    const auto address = Address(Address::binanceHRP, keyhash).encode();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Address::decode(address));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AddressDecode);
+
+static void BM_Hex(benchmark::State& state) {
+    const Data data(state.range(0), 0xA5);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hex(data));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_Hex)->Arg(20)->Arg(256)->Arg(4096);
+
+static void BM_ParseHex(benchmark::State& state) {
+    const auto text = hex(Data(state.range(0), 0xA5));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parse_hex(text));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ParseHex)->Arg(20)->Arg(256)->Arg(4096);
+
+static void BM_AminoWrap(benchmark::State& state) {
+    const auto raw = std::string(state.range(0), 'x');
+    const auto prefix = parse_hex("ce6dc043");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Amino::wrap(raw, prefix, true));
+    }
+    state.SetBytesProcessed(state.iterations() * raw.size());
+}
+BENCHMARK(BM_AminoWrap)->Arg(64)->Arg(1024)->Arg(16 << 10);
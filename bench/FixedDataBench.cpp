@@ -0,0 +1,87 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "AllocationCounter.h"
+#include "FixedData.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/secp256k1.h"
+#include "crypto/sha2.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace Binance;
+
+/// Compressed public keys of deterministic private keys, as inline values and as `Data`.
+static const std::vector<PublicKey>& fixedKeys() {
+    static const auto keys = [] {
+        std::vector<PublicKey> keys(1024);
+        for (size_t i = 0; i < keys.size(); i += 1) {
+            const auto seed = std::to_string(i);
+            PrivateKey privateKey;
+            sha256_Raw(reinterpret_cast<const uint8_t*>(seed.data()), seed.size(), privateKey.data());
+            ecdsa_get_public_key33(&secp256k1, privateKey.data(), keys[i].data());
+        }
+        return keys;
+    }();
+    return keys;
+}
+
+static const std::vector<Data>& dataKeys() {
+    static const auto keys = std::vector<Data>(fixedKeys().begin(), fixedKeys().end());
+    return keys;
+}
+
+/// Copies a key set, as a batch of signers or a cache refill would.
+template <typename Key>
+static void copyKeys(benchmark::State& state, const std::vector<Key>& keys) {
+    auto counter = AllocationCounter();
+    for (auto _ : state) {
+        auto copy = keys;
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.counters["allocs"] = counter.allocations() / static_cast<double>(state.iterations());
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(keys.size()));
+}
+
+static void BM_CopyKeysFixedData(benchmark::State& state) {
+    copyKeys(state, fixedKeys());
+}
+BENCHMARK(BM_CopyKeysFixedData);
+
+static void BM_CopyKeysData(benchmark::State& state) {
+    copyKeys(state, dataKeys());
+}
+BENCHMARK(BM_CopyKeysData);
+
+/// Sorts a key set, which touches every key repeatedly and shows the cost of the indirection.
+template <typename Key>
+static void sortKeys(benchmark::State& state, const std::vector<Key>& keys) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto copy = keys;
+        std::reverse(copy.begin(), copy.end());
+        state.ResumeTiming();
+        std::sort(copy.begin(), copy.end());
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(keys.size()));
+}
+
+static void BM_SortKeysFixedData(benchmark::State& state) {
+    sortKeys(state, fixedKeys());
+}
+BENCHMARK(BM_SortKeysFixedData);
+
+static void BM_SortKeysData(benchmark::State& state) {
+    sortKeys(state, dataKeys());
+}
+BENCHMARK(BM_SortKeysData);
@@ -0,0 +1,124 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HDWallet.h"
+
+#include "crypto/bip32.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+using namespace Binance;
+
+static const auto benchSeed = HDWallet::mnemonicSeed(
+    "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about");
+
+static void BM_MnemonicSeed(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(HDWallet::mnemonicSeed("abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about"));
+    }
+}
+BENCHMARK(BM_MnemonicSeed);
+
+/// Walks the full path from the master node for every key, as without a cache.
+static void BM_DeriveKeyFromMaster(benchmark::State& state) {
+    HDNode master;
+    hdnode_from_seed(benchSeed.data(), benchSeed.size(), &master);
+    uint32_t index = 0;
+    for (auto _ : state) {
+        auto node = master;
+        hdnode_private_ckd(&node, 44 | HDWallet::hardened);
+        hdnode_private_ckd(&node, HDWallet::coinType | HDWallet::hardened);
+        hdnode_private_ckd(&node, 0 | HDWallet::hardened);
+        hdnode_private_ckd(&node, 0);
+        hdnode_private_ckd(&node, index++ % HDWallet::hardened);
+        benchmark::DoNotOptimize(node.private_key);
+    }
+}
+BENCHMARK(BM_DeriveKeyFromMaster);
+
+static void BM_DeriveKeyCached(benchmark::State& state) {
+    HDWallet wallet(benchSeed);
+    uint32_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(wallet.privateKey(index++ % HDWallet::hardened));
+    }
+}
+BENCHMARK(BM_DeriveKeyCached);
+
+static void BM_DeriveRange(benchmark::State& state) {
+    HDWallet wallet(benchSeed);
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(wallet.deriveRange(0, count, 0, static_cast<size_t>(state.range(1))).data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_DeriveRange)->Args({10000, 1})->Args({10000, 0})->UseRealTime();
+
+/// Seeds of 64 mnemonics, one at a time and in lanes.
+static void mnemonicSeeds(benchmark::State& state, bool lanes) {
+    auto mnemonics = std::vector<std::string>();
+    for (size_t i = 0; i < 64; i += 1) {
+        mnemonics.push_back("abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about " + std::to_string(i));
+    }
+    for (auto _ : state) {
+        if (lanes) {
+            benchmark::DoNotOptimize(HDWallet::mnemonicSeeds(mnemonics, "", 1).data());
+        } else {
+            for (const auto& mnemonic : mnemonics) {
+                benchmark::DoNotOptimize(HDWallet::mnemonicSeed(mnemonic));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(mnemonics.size()));
+}
+
+static void BM_MnemonicSeedsSequential(benchmark::State& state) {
+    mnemonicSeeds(state, false);
+}
+BENCHMARK(BM_MnemonicSeedsSequential);
+
+static void BM_MnemonicSeedsLanes(benchmark::State& state) {
+    mnemonicSeeds(state, true);
+}
+BENCHMARK(BM_MnemonicSeedsLanes);
+
+/// Public keys and addresses of deposit accounts from an account xpub.
+static void BM_PublicKeysFromXpub(benchmark::State& state) {
+    HDWallet wallet(benchSeed);
+    const auto external = wallet.extendedPublicKey().child(0);
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(external.publicKeys(0, count).data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_PublicKeysFromXpub)->Arg(1)->Arg(1000);
+
+static void BM_AddressesFromXpub(benchmark::State& state) {
+    HDWallet wallet(benchSeed);
+    const auto external = wallet.extendedPublicKey().child(0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(external.addresses(0, 1000).data());
+    }
+    state.SetItemsProcessed(state.iterations() * 1000);
+}
+BENCHMARK(BM_AddressesFromXpub);
+
+/// One public child at a time through the affine API, an inversion per key.
+static void BM_PublicChildFromXpub(benchmark::State& state) {
+    HDWallet wallet(benchSeed);
+    const auto external = wallet.extendedPublicKey().child(0);
+    uint32_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(external.child(index++ % HDWallet::hardened));
+    }
+}
+BENCHMARK(BM_PublicChildFromXpub);
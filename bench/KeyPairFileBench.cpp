@@ -0,0 +1,54 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "KeyPairFile.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/rand.h"
+#include "crypto/secp256k1.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <vector>
+
+using namespace Binance;
+
+/// A random key and a full multiplication per account.
+static void BM_KeyPairsIndependent(benchmark::State& state) {
+    KeyRecord record;
+    uint8_t publicKey[33];
+    for (auto _ : state) {
+        random_buffer(record.privateKey.data(), record.privateKey.size());
+        ecdsa_get_public_key33(&secp256k1, record.privateKey.data(), publicKey);
+        ecdsa_get_pubkeyhash(publicKey, HASHER_SHA2_RIPEMD, record.keyHash.data());
+        benchmark::DoNotOptimize(record);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_KeyPairsIndependent);
+
+static void BM_KeyPairsIncremental(benchmark::State& state) {
+    auto generator = KeyPairGenerator();
+    auto records = std::vector<KeyRecord>(1024);
+    for (auto _ : state) {
+        generator.generate(records.data(), records.size());
+        benchmark::DoNotOptimize(records.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(records.size()));
+}
+BENCHMARK(BM_KeyPairsIncremental);
+
+static void BM_KeyPairFileWrite(benchmark::State& state) {
+    const auto path = std::string("/tmp/binance-chain-bench-keys.bin");
+    for (auto _ : state) {
+        KeyPairFile::write(path, 100000);
+    }
+    std::remove(path.c_str());
+    state.SetItemsProcessed(state.iterations() * 100000);
+}
+BENCHMARK(BM_KeyPairFileWrite)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,132 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Amino.h"
+#include "HexCoding.h"
+#include "Messages.h"
+#include "Signer.h"
+
+#include "dex.pb.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace Binance;
+
+static const auto messagesKeyhash = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+static const auto messagesToKeyhash = parse_hex("88b37d5e05f3699e2a1406468e5d87cb9dcceb95");
+
+static Messages::NewOrder makeNewOrderStruct() {
+    auto order = Messages::NewOrder();
+    order.sender = messagesKeyhash;
+    order.id = "B6561DCC104130059A7C08F48C64610C1F6F9064-11";
+    order.symbol = "BTC-5C4_BNB";
+    order.ordertype = 2;
+    order.side = 1;
+    order.price = 100000000;
+    order.quantity = 1200000000;
+    order.timeinforce = 1;
+    return order;
+}
+
+static NewOrder makeNewOrderMessage() {
+    auto order = NewOrder();
+    order.set_sender(messagesKeyhash.data(), messagesKeyhash.size());
+    order.set_id("B6561DCC104130059A7C08F48C64610C1F6F9064-11");
+    order.set_symbol("BTC-5C4_BNB");
+    order.set_ordertype(2);
+    order.set_side(1);
+    order.set_price(100000000);
+    order.set_quantity(1200000000);
+    order.set_timeinforce(1);
+    return order;
+}
+
+static Messages::Send makeSendStruct() {
+    auto order = Messages::Send();
+    order.inputs.push_back({messagesKeyhash, {{"BNB", 1001000000}}});
+    order.outputs.push_back({messagesToKeyhash, {{"BNB", 1001000000}}});
+    return order;
+}
+
+static Send makeSendMessage() {
+    auto order = Send();
+    auto input = order.add_inputs();
+    input->set_address(messagesKeyhash.data(), messagesKeyhash.size());
+    auto inputCoin = input->add_coins();
+    inputCoin->set_denom("BNB");
+    inputCoin->set_amount(1001000000);
+    auto output = order.add_outputs();
+    output->set_address(messagesToKeyhash.data(), messagesToKeyhash.size());
+    output->add_coins()->CopyFrom(*inputCoin);
+    return order;
+}
+
+static void BM_EncodeNewOrderStruct(benchmark::State& state) {
+    const auto order = makeNewOrderStruct();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Messages::encodeOrder(order));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EncodeNewOrderStruct);
+
+static void BM_EncodeNewOrderGenerated(benchmark::State& state) {
+    const auto order = makeNewOrderMessage();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Amino::encodeOrder(order));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EncodeNewOrderGenerated);
+
+static void BM_EncodeSendStruct(benchmark::State& state) {
+    const auto order = makeSendStruct();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Messages::encodeOrder(order));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EncodeSendStruct);
+
+static void BM_EncodeSendGenerated(benchmark::State& state) {
+    const auto order = makeSendMessage();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Amino::encodeOrder(order));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EncodeSendGenerated);
+
+/// Builds the order, as a caller filling in a new order per transaction does.
+static void BM_BuildAndEncodeNewOrderStruct(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Messages::encodeOrder(makeNewOrderStruct()));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BuildAndEncodeNewOrderStruct);
+
+static void BM_BuildAndEncodeNewOrderGenerated(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Amino::encodeOrder(makeNewOrderMessage()));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BuildAndEncodeNewOrderGenerated);
+
+static void BM_SignerBuildEncodedOrder(benchmark::State& state) {
+    const auto encoded = Messages::encodeOrder(makeNewOrderStruct());
+    auto signer = Signer(encoded);
+    signer.accountNumber = 1;
+    signer.sequence = 10;
+    signer.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(signer.build());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SignerBuildEncodedOrder);
@@ -0,0 +1,84 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HexCoding.h"
+#include "PublicKeyCache.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/secp256k1.h"
+#include "crypto/sha2.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace Binance;
+
+struct KeySignatures {
+    static const size_t count = 64;
+    uint8_t publicKey[33];
+    uint8_t signatures[count][64];
+    uint8_t digests[count][32];
+
+    KeySignatures() {
+        const auto privateKey = parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9");
+        ecdsa_get_public_key33(&secp256k1, privateKey.data(), publicKey);
+        for (size_t i = 0; i < count; i += 1) {
+            const auto message = std::to_string(i);
+            sha256_Raw(reinterpret_cast<const uint8_t*>(message.data()), message.size(), digests[i]);
+            ecdsa_sign_digest(&secp256k1, privateKey.data(), digests[i], signatures[i], nullptr, nullptr);
+        }
+    }
+};
+
+static const KeySignatures& keySignatures() {
+    static const KeySignatures instance;
+    return instance;
+}
+
+static void BM_ReadPublicKey(benchmark::State& state) {
+    const auto& input = keySignatures();
+    for (auto _ : state) {
+        curve_point point;
+        benchmark::DoNotOptimize(ecdsa_read_pubkey(&secp256k1, input.publicKey, &point));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ReadPublicKey);
+
+static void BM_FindPublicKey(benchmark::State& state) {
+    auto cache = PublicKeyCache(1024);
+    const auto& input = keySignatures();
+    for (auto _ : state) {
+        curve_point point;
+        benchmark::DoNotOptimize(cache.find(input.publicKey, point));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FindPublicKey);
+
+static void BM_VerifyDigest(benchmark::State& state) {
+    const auto& input = keySignatures();
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ecdsa_verify_digest(&secp256k1, input.publicKey, input.signatures[i], input.digests[i]));
+        i = (i + 1) % KeySignatures::count;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_VerifyDigest);
+
+// Argument 1 keeps the odd multiples table per key.
+static void BM_VerifyCachedKey(benchmark::State& state) {
+    auto cache = PublicKeyCache(1024, state.range(0) != 0);
+    const auto& input = keySignatures();
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cache.verify(input.publicKey, input.signatures[i], input.digests[i]));
+        i = (i + 1) % KeySignatures::count;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_VerifyCachedKey)->Arg(0)->Arg(1);
@@ -0,0 +1,75 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Recovery.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/secp256k1.h"
+#include "crypto/sha2.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace Binance;
+
+static const size_t signatureCount = 1024;
+
+struct Signatures {
+    Data signatures = Data(signatureCount * 64);
+    Data digests = Data(signatureCount * 32);
+    Data recoveryIds = Data(signatureCount);
+
+    Signatures() {
+        for (size_t i = 0; i < signatureCount; i += 1) {
+            const auto seed = std::to_string(i);
+            uint8_t privateKey[SHA256_DIGEST_LENGTH];
+            sha256_Raw(reinterpret_cast<const uint8_t*>(seed.data()), seed.size(), privateKey);
+            sha256_Raw(privateKey, sizeof(privateKey), &digests[32 * i]);
+            ecdsa_sign_digest(&secp256k1, privateKey, &digests[32 * i], &signatures[64 * i], &recoveryIds[i], nullptr);
+        }
+    }
+};
+
+static const Signatures& signatures() {
+    static const Signatures instance;
+    return instance;
+}
+
+// Baseline: one ecdsa_recover_pub_from_sig call per signature.
+static void BM_RecoverPublicKey(benchmark::State& state) {
+    const auto& input = signatures();
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(recoverPublicKey(&input.signatures[64 * i], &input.digests[32 * i], input.recoveryIds[i]));
+        i = (i + 1) % signatureCount;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RecoverPublicKey);
+
+// One argument per thread count.
+static void BM_RecoverPublicKeys(benchmark::State& state) {
+    const auto& input = signatures();
+    Data publicKeys(signatureCount * 33);
+    std::unique_ptr<bool[]> results(new bool[signatureCount]);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(recoverPublicKeys(input.signatures.data(), input.digests.data(), input.recoveryIds.data(), signatureCount,
+            publicKeys.data(), results.get(), state.range(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * signatureCount);
+}
+BENCHMARK(BM_RecoverPublicKeys)->Apply([](benchmark::internal::Benchmark* benchmark) {
+    const auto cores = static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u));
+    for (int threads = 1; threads < cores; threads *= 2) {
+        benchmark->Arg(threads);
+    }
+    benchmark->Arg(cores);
+})->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,66 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HexCoding.h"
+#include "SignatureCache.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/secp256k1.h"
+#include "crypto/sha2.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace Binance;
+
+struct SignedDigests {
+    static const size_t count = 256;
+    uint8_t publicKey[33];
+    uint8_t signatures[count][64];
+    uint8_t digests[count][32];
+
+    SignedDigests() {
+        const auto privateKey = parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9");
+        ecdsa_get_public_key33(&secp256k1, privateKey.data(), publicKey);
+        for (size_t i = 0; i < count; i += 1) {
+            const auto message = std::to_string(i);
+            sha256_Raw(reinterpret_cast<const uint8_t*>(message.data()), message.size(), digests[i]);
+            ecdsa_sign_digest(&secp256k1, privateKey.data(), digests[i], signatures[i], nullptr, nullptr);
+        }
+    }
+};
+
+static const SignedDigests& signedDigests() {
+    static const SignedDigests instance;
+    return instance;
+}
+
+static void BM_VerifyUncached(benchmark::State& state) {
+    const auto& input = signedDigests();
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ecdsa_verify_digest(&secp256k1, input.publicKey, input.signatures[i], input.digests[i]));
+        i = (i + 1) % SignedDigests::count;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_VerifyUncached);
+
+// Every lookup hits, measured from concurrent threads sharing one cache.
+static void BM_VerifyCached(benchmark::State& state) {
+    static SignatureCache cache(1 << 16);
+    const auto& input = signedDigests();
+    for (size_t i = 0; i < SignedDigests::count; i += 1) {
+        cache.insert(input.publicKey, input.signatures[i], input.digests[i]);
+    }
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cache.verify(input.publicKey, input.signatures[i], input.digests[i]));
+        i = (i + 1) % SignedDigests::count;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_VerifyCached)->ThreadRange(1, 8);
@@ -0,0 +1,168 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HexCoding.h"
+#include "Serialization.h"
+#include "Signer.h"
+
+#include "dex.pb.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+using namespace Binance;
+
+static const auto keyhash = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+
+static std::unique_ptr<::google::protobuf::Message> makeNewOrder() {
+    auto order = std::unique_ptr<NewOrder>(new NewOrder());
+    order->set_sender(keyhash.data(), keyhash.size());
+    order->set_id("B6561DCC104130059A7C08F48C64610C1F6F9064-11");
+    order->set_symbol("BTC-5C4_BNB");
+    order->set_ordertype(2);
+    order->set_side(1);
+    order->set_price(100000000);
+    order->set_quantity(1200000000);
+    order->set_timeinforce(1);
+    return order;
+}
+
+static std::unique_ptr<::google::protobuf::Message> makeCancelOrder() {
+    // The sender stays empty, raw key hash bytes are not valid UTF-8 in the JSON preimage.
+    auto order = std::unique_ptr<CancelOrder>(new CancelOrder());
+    order->set_symbol("BTC-5C4_BNB");
+    order->set_refid("B6561DCC104130059A7C08F48C64610C1F6F9064-10");
+    return order;
+}
+
+static std::unique_ptr<::google::protobuf::Message> makeTokenFreeze() {
+    auto order = std::unique_ptr<TokenFreeze>(new TokenFreeze());
+    order->set_from(keyhash.data(), keyhash.size());
+    order->set_symbol("ABC-123");
+    order->set_amount(100000000);
+    return order;
+}
+
+static std::unique_ptr<::google::protobuf::Message> makeTokenUnfreeze() {
+    auto order = std::unique_ptr<TokenUnfreeze>(new TokenUnfreeze());
+    order->set_from(keyhash.data(), keyhash.size());
+    order->set_symbol("ABC-123");
+    order->set_amount(100000000);
+    return order;
+}
+
+static std::unique_ptr<::google::protobuf::Message> makeSend() {
+    auto order = std::unique_ptr<Send>(new Send());
+    auto input = order->add_inputs();
+    input->set_address(keyhash.data(), keyhash.size());
+    auto inputCoin = input->add_coins();
+    inputCoin->set_denom("BNB");
+    inputCoin->set_amount(1001000000);
+    auto toKeyhash = parse_hex("88b37d5e05f3699e2a1406468e5d87cb9dcceb95");
+    auto output = order->add_outputs();
+    output->set_address(toKeyhash.data(), toKeyhash.size());
+    auto outputCoin = output->add_coins();
+    outputCoin->set_denom("BNB");
+    outputCoin->set_amount(1001000000);
+    return order;
+}
+
+static Signer makeSigner(const ::google::protobuf::Message& order) {
+    auto signer = Signer(order);
+    signer.accountNumber = 1;
+    signer.sequence = 10;
+    signer.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
+    return signer;
+}
+
+template <class Factory>
+static void BM_SignaturePreimage(benchmark::State& state, Factory factory) {
+    const auto order = factory();
+    const auto signer = makeSigner(*order);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(signaturePreimage(signer));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_SignaturePreimage, NewOrder, makeNewOrder);
+BENCHMARK_CAPTURE(BM_SignaturePreimage, CancelOrder, makeCancelOrder);
+BENCHMARK_CAPTURE(BM_SignaturePreimage, TokenFreeze, makeTokenFreeze);
+BENCHMARK_CAPTURE(BM_SignaturePreimage, TokenUnfreeze, makeTokenUnfreeze);
+BENCHMARK_CAPTURE(BM_SignaturePreimage, Send, makeSend);
+
+template <class Factory>
+static void BM_SignerSign(benchmark::State& state, Factory factory) {
+    const auto order = factory();
+    const auto signer = makeSigner(*order);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(signer.sign());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_SignerSign, NewOrder, makeNewOrder);
+BENCHMARK_CAPTURE(BM_SignerSign, CancelOrder, makeCancelOrder);
+BENCHMARK_CAPTURE(BM_SignerSign, TokenFreeze, makeTokenFreeze);
+BENCHMARK_CAPTURE(BM_SignerSign, TokenUnfreeze, makeTokenUnfreeze);
+BENCHMARK_CAPTURE(BM_SignerSign, Send, makeSend);
+
+template <class Factory>
+static void BM_SignerBuildOrder(benchmark::State& state, Factory factory) {
+    const auto order = factory();
+    const auto signer = makeSigner(*order);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(signer.build());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_SignerBuildOrder, NewOrder, makeNewOrder);
+BENCHMARK_CAPTURE(BM_SignerBuildOrder, CancelOrder, makeCancelOrder);
+BENCHMARK_CAPTURE(BM_SignerBuildOrder, TokenFreeze, makeTokenFreeze);
+BENCHMARK_CAPTURE(BM_SignerBuildOrder, TokenUnfreeze, makeTokenUnfreeze);
+BENCHMARK_CAPTURE(BM_SignerBuildOrder, Send, makeSend);
+
+template <class Factory>
+static void BM_SignerBuildArena(benchmark::State& state, Factory factory) {
+    const auto order = factory();
+    const auto signer = makeSigner(*order);
+    Arena arena;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(signer.build(arena).data());
+        arena.reset();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_SignerBuildArena, NewOrder, makeNewOrder);
+BENCHMARK_CAPTURE(BM_SignerBuildArena, CancelOrder, makeCancelOrder);
+BENCHMARK_CAPTURE(BM_SignerBuildArena, TokenFreeze, makeTokenFreeze);
+BENCHMARK_CAPTURE(BM_SignerBuildArena, TokenUnfreeze, makeTokenUnfreeze);
+BENCHMARK_CAPTURE(BM_SignerBuildArena, Send, makeSend);
+
+template <class Factory>
+static void BM_SignerBuildBuffer(benchmark::State& state, Factory factory) {
+    const auto order = factory();
+    const auto signer = makeSigner(*order);
+    auto buffer = Data(signer.encodedSize());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(signer.build(buffer).data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_SignerBuildBuffer, NewOrder, makeNewOrder);
+BENCHMARK_CAPTURE(BM_SignerBuildBuffer, Send, makeSend);
+
+template <class Factory>
+static void BM_SignerEncodedSize(benchmark::State& state, Factory factory) {
+    const auto order = factory();
+    const auto signer = makeSigner(*order);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(signer.encodedSize());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_SignerEncodedSize, NewOrder, makeNewOrder);
+BENCHMARK_CAPTURE(BM_SignerEncodedSize, Send, makeSend);
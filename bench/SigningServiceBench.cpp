@@ -0,0 +1,67 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HexCoding.h"
+#include "SigningService.h"
+
+#include "dex.pb.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <thread>
+
+using namespace Binance;
+
+static const size_t accountCount = 64;
+static const size_t batchSize = 256;
+
+// Signs batches of orders spread over many accounts, one argument per worker count.
+static void BM_SigningService(benchmark::State& state) {
+    AccountRegistry accounts;
+    const auto privateKey = parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9");
+    for (size_t i = 0; i < accountCount; i += 1) {
+        accounts.add(std::to_string(i), privateKey, i, 0);
+    }
+
+    auto order = NewOrder();
+    auto keyhash = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+    order.set_sender(keyhash.data(), keyhash.size());
+    order.set_id("B6561DCC104130059A7C08F48C64610C1F6F9064-1");
+    order.set_symbol("BTC-5C4_BNB");
+    order.set_ordertype(2);
+    order.set_side(1);
+    order.set_price(100000000);
+    order.set_quantity(1200000000);
+    order.set_timeinforce(1);
+
+    SigningService service(accounts, "chain-bnb", state.range(0));
+    std::vector<std::future<Data>> futures(batchSize);
+    for (auto _ : state) {
+        for (size_t i = 0; i < batchSize; i += 1) {
+            futures[i] = service.submit(std::to_string(i % accountCount), order);
+        }
+        for (auto& future : futures) {
+            benchmark::DoNotOptimize(future.get());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * batchSize);
+
+    const auto metrics = service.metrics();
+    state.counters["queue_p50_us"] = metrics.queue.p50.count() / 1e3;
+    state.counters["sign_p50_us"] = metrics.signing.p50.count() / 1e3;
+    state.counters["sign_p99_us"] = metrics.signing.p99.count() / 1e3;
+    state.counters["total_p99_us"] = metrics.total.p99.count() / 1e3;
+    state.counters["stolen"] = metrics.stolen;
+}
+BENCHMARK(BM_SigningService)->Apply([](benchmark::internal::Benchmark* benchmark) {
+    const auto cores = static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u));
+    for (int threads = 1; threads < cores; threads *= 2) {
+        benchmark->Arg(threads);
+    }
+    benchmark->Arg(cores);
+})->UseRealTime();
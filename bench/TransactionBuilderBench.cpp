@@ -0,0 +1,68 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HexCoding.h"
+#include "Signer.h"
+#include "TransactionBuilder.h"
+
+#include "dex.pb.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace Binance;
+
+static std::vector<NewOrder> makeOrders(size_t count) {
+    auto keyhash = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+    std::vector<NewOrder> orders(count);
+    for (size_t i = 0; i < count; i += 1) {
+        orders[i].set_sender(keyhash.data(), keyhash.size());
+        orders[i].set_id("B6561DCC104130059A7C08F48C64610C1F6F9064-" + std::to_string(i));
+        orders[i].set_symbol("BTC-5C4_BNB");
+        orders[i].set_ordertype(2);
+        orders[i].set_side(1);
+        orders[i].set_price(100000000);
+        orders[i].set_quantity(1200000000);
+        orders[i].set_timeinforce(1);
+    }
+    return orders;
+}
+
+static const auto privateKey = parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9");
+
+// One transaction and one signature per order.
+static void BM_SignerBuild(benchmark::State& state) {
+    const auto orders = makeOrders(state.range(0));
+    for (auto _ : state) {
+        int64_t sequence = 0;
+        for (auto& order : orders) {
+            auto signer = Signer(order);
+            signer.accountNumber = 1;
+            signer.sequence = sequence++;
+            signer.privateKey = PrivateKey(privateKey);
+            benchmark::DoNotOptimize(signer.build());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SignerBuild)->Arg(1)->Arg(8)->Arg(32)->Arg(128);
+
+// All orders packed in one transaction under a single signature.
+static void BM_TransactionBuilderBuild(benchmark::State& state) {
+    const auto orders = makeOrders(state.range(0));
+    for (auto _ : state) {
+        auto builder = TransactionBuilder();
+        builder.accountNumber = 1;
+        builder.sequence = 0;
+        builder.privateKey = PrivateKey(privateKey);
+        for (auto& order : orders) {
+            builder.add(order);
+        }
+        benchmark::DoNotOptimize(builder.build());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TransactionBuilderBuild)->Arg(1)->Arg(8)->Arg(32)->Arg(128);
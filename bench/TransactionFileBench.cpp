@@ -0,0 +1,77 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HexCoding.h"
+#include "TransactionBuilder.h"
+#include "TransactionFile.h"
+
+#include "dex.pb.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+using namespace Binance;
+
+static const size_t fileSize = 64 << 20;
+
+// Writes a dump of eight-order transactions, the signatures are reused since only decoding is measured.
+static std::string makeFile() {
+    auto keyhash = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+    std::vector<NewOrder> orders(8);
+    auto builder = TransactionBuilder();
+    builder.accountNumber = 1;
+    builder.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
+    for (size_t i = 0; i < orders.size(); i += 1) {
+        orders[i].set_sender(keyhash.data(), keyhash.size());
+        orders[i].set_id("B6561DCC104130059A7C08F48C64610C1F6F9064-" + std::to_string(i));
+        orders[i].set_symbol("BTC-5C4_BNB");
+        orders[i].set_ordertype(2);
+        orders[i].set_side(1);
+        orders[i].set_price(100000000);
+        orders[i].set_quantity(1200000000);
+        orders[i].set_timeinforce(1);
+        builder.add(orders[i]);
+    }
+    const auto transaction = builder.build();
+
+    const auto path = std::string("/tmp/binance-chain-bench-transactions.bin");
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    for (size_t size = 0; size < fileSize; size += transaction.size()) {
+        file.write(reinterpret_cast<const char*>(transaction.data()), transaction.size());
+    }
+    return path;
+}
+
+// Decodes the whole file, one argument per thread count.
+static void BM_TransactionFileProcess(benchmark::State& state) {
+    const auto path = makeFile();
+    auto stats = TransactionFileReader::Stats();
+    {
+        auto reader = TransactionFileReader(path);
+        for (auto _ : state) {
+            stats = reader.process(state.range(0), [](const Amino::TransactionView& transaction) {
+                benchmark::DoNotOptimize(transaction.source);
+            });
+        }
+        state.SetBytesProcessed(state.iterations() * stats.bytes);
+        state.SetItemsProcessed(state.iterations() * stats.transactions);
+    }
+    std::remove(path.c_str());
+    state.counters["MB/s"] = stats.megabytesPerSecond();
+    state.counters["tx/s"] = stats.transactionsPerSecond();
+}
+BENCHMARK(BM_TransactionFileProcess)->Apply([](benchmark::internal::Benchmark* benchmark) {
+    const auto cores = static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u));
+    for (int threads = 1; threads < cores; threads *= 2) {
+        benchmark->Arg(threads);
+    }
+    benchmark->Arg(cores);
+})->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,88 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Decoder.h"
+#include "HexCoding.h"
+#include "Messages.h"
+#include "Signer.h"
+#include "Verifier.h"
+
+#include "crypto/sha2.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+
+using namespace Binance;
+
+static Data makeTransaction(int64_t sequence) {
+    auto order = Messages::NewOrder();
+    order.sender = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+    order.id = "B6561DCC104130059A7C08F48C64610C1F6F9064-" + std::to_string(sequence);
+    order.symbol = "BTC-5C4_BNB";
+    order.ordertype = 2;
+    order.side = 1;
+    order.price = 100000000;
+    order.quantity = 1200000000;
+    order.timeinforce = 1;
+
+    const auto encoded = Messages::encodeOrder(order);
+    auto signer = Signer(encoded);
+    signer.accountNumber = 1;
+    signer.sequence = sequence;
+    signer.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
+    return signer.build();
+}
+
+// Decoding and preimage hashing only, the part of verification that is not elliptic curve arithmetic.
+static void BM_PreimageDigest(benchmark::State& state) {
+    const auto transaction = makeTransaction(1);
+    for (auto _ : state) {
+        Amino::TransactionView view;
+        Amino::decodeTransaction(transaction, view);
+        uint8_t digest[SHA256_DIGEST_LENGTH];
+        preimageDigest(view, *view.signatures.begin(), "chain-bnb", digest);
+        benchmark::DoNotOptimize(digest);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PreimageDigest);
+
+static void BM_VerifyTransaction(benchmark::State& state) {
+    const auto transaction = makeTransaction(1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(verifyTransaction(transaction.data(), transaction.size()));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_VerifyTransaction);
+
+// Batches of 256 transactions, one argument per thread count.
+static void BM_VerifyTransactions(benchmark::State& state) {
+    std::vector<Data> transactions;
+    std::vector<ByteSpan> spans;
+    for (int64_t i = 0; i < 256; i += 1) {
+        transactions.push_back(makeTransaction(i));
+    }
+    for (const auto& transaction : transactions) {
+        spans.emplace_back(transaction);
+    }
+    std::unique_ptr<bool[]> results(new bool[spans.size()]);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(verifyTransactions(spans.data(), spans.size(), results.get(), "chain-bnb", state.range(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * spans.size());
+}
+BENCHMARK(BM_VerifyTransactions)->Apply([](benchmark::internal::Benchmark* benchmark) {
+    const auto cores = static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u));
+    for (int threads = 1; threads < cores; threads *= 2) {
+        benchmark->Arg(threads);
+    }
+    benchmark->Arg(cores);
+})->UseRealTime();
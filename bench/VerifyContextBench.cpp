@@ -0,0 +1,76 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HexCoding.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/secp256k1.h"
+#include "crypto/sha2.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+using namespace Binance;
+
+struct ContextSignatures {
+    static const size_t count = 64;
+    uint8_t publicKey[33];
+    uint8_t signatures[count][64];
+    uint8_t digests[count][32];
+
+    ContextSignatures() {
+        const auto privateKey = parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9");
+        ecdsa_get_public_key33(&secp256k1, privateKey.data(), publicKey);
+        for (size_t i = 0; i < count; i += 1) {
+            const auto message = std::to_string(i);
+            sha256_Raw(reinterpret_cast<const uint8_t*>(message.data()), message.size(), digests[i]);
+            ecdsa_sign_digest(&secp256k1, privateKey.data(), digests[i], signatures[i], nullptr, nullptr);
+        }
+    }
+};
+
+static const ContextSignatures& contextSignatures() {
+    static const ContextSignatures instance;
+    return instance;
+}
+
+// Generic path: decompress the key and run two separate multiplications.
+static void BM_VerifyGeneric(benchmark::State& state) {
+    const auto& input = contextSignatures();
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ecdsa_verify_digest(&secp256k1, input.publicKey, input.signatures[i], input.digests[i]));
+        i = (i + 1) % ContextSignatures::count;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_VerifyGeneric);
+
+static void BM_VerifyContextInit(benchmark::State& state) {
+    const auto& input = contextSignatures();
+    for (auto _ : state) {
+        auto context = ecdsa_verify_ctx_create(&secp256k1, input.publicKey);
+        benchmark::DoNotOptimize(context);
+        ecdsa_verify_ctx_free(context);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_VerifyContextInit);
+
+static void BM_VerifyWithContext(benchmark::State& state) {
+    const auto& input = contextSignatures();
+    const auto context = std::unique_ptr<ecdsa_verify_ctx, decltype(&ecdsa_verify_ctx_free)>(
+        ecdsa_verify_ctx_create(&secp256k1, input.publicKey), ecdsa_verify_ctx_free);
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ecdsa_verify_digest_with_ctx(&secp256k1, context.get(), input.signatures[i], input.digests[i]));
+        i = (i + 1) % ContextSignatures::count;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_VerifyWithContext);
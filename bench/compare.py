@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+#
+# Copyright © 2019 Binance.
+#
+# This file is part of the Binance Chain SDK. The full Binance Chain SDK
+# copyright notice, including terms governing use, modification, and
+# redistribution, is contained in the file LICENSE at the root of the source
+# code distribution tree.
+
+"""Compares two Google Benchmark JSON reports and flags regressions.
+
+Usage: compare.py BASELINE CURRENT [--threshold PERCENT] [--metric real_time|cpu_time]
+
+Runs with repetitions are compared by their median. Exits with status 1 if any
+benchmark is slower than the baseline by more than the threshold. Without a
+baseline file the comparison is skipped and the exit status is 0.
+"""
+
+import argparse
+import json
+import sys
+
+UNITS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(path, metric):
+    """Returns the time in nanoseconds of every benchmark in a report, by name."""
+    with open(path) as file:
+        report = json.load(file)
+    times = {}
+    medians = {}
+    for benchmark in report.get("benchmarks", []):
+        if benchmark.get("error_occurred"):
+            continue
+        time = benchmark[metric] * UNITS[benchmark.get("time_unit", "ns")]
+        if benchmark.get("run_type") == "aggregate":
+            if benchmark.get("aggregate_name") == "median":
+                medians[benchmark["run_name"]] = time
+            continue
+        times[benchmark.get("run_name", benchmark["name"])] = time
+    times.update(medians)
+    return times
+
+
+def format_time(nanoseconds):
+    for unit in ("s", "ms", "us"):
+        if nanoseconds >= UNITS[unit]:
+            return "%.2f %s" % (nanoseconds / UNITS[unit], unit)
+    return "%.1f ns" % nanoseconds
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare benchmark results against a baseline.")
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=10.0, help="allowed slowdown in percent")
+    parser.add_argument("--metric", choices=("real_time", "cpu_time"), default="real_time")
+    args = parser.parse_args()
+
+    try:
+        baseline = load(args.baseline, args.metric)
+    except FileNotFoundError:
+        print("Skipping the comparison: no baseline at %s. Copy a bench.json from a release build there to create one."
+              % args.baseline)
+        return 0
+    current = load(args.current, args.metric)
+
+    regressions = []
+    width = max([len(name) for name in current] + [9])
+    print("%-*s %12s %12s %9s" % (width, "Benchmark", "Baseline", "Current", "Change"))
+    for name in sorted(current):
+        if name not in baseline:
+            print("%-*s %12s %12s %9s" % (width, name, "-", format_time(current[name]), "new"))
+            continue
+        change = (current[name] / baseline[name] - 1) * 100
+        flag = ""
+        if change > args.threshold:
+            regressions.append(name)
+            flag = "  REGRESSION"
+        print("%-*s %12s %12s %+8.1f%%%s" % (width, name, format_time(baseline[name]), format_time(current[name]), change, flag))
+    for name in sorted(set(baseline) - set(current)):
+        print("%-*s %12s %12s %9s" % (width, name, format_time(baseline[name]), "-", "missing"))
+
+    if regressions:
+        print("\n%d benchmark(s) slower than the baseline by more than %g%%." % (len(regressions), args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,50 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "AccountRegistry.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/secp256k1.h"
+
+#include <mutex>
+
+using namespace Binance;
+
+static PublicKey publicKeyOf(const PrivateKey& privateKey) {
+    auto publicKey = PublicKey();
+    ecdsa_get_public_key33(&secp256k1, privateKey.data(), publicKey.data());
+    return publicKey;
+}
+
+Account::Account(const Data& privateKey, int64_t accountNumber, int64_t sequence)
+    : privateKey(privateKey), publicKey(publicKeyOf(this->privateKey)), accountNumber(accountNumber), next(sequence) {}
+
+std::shared_ptr<Account> AccountRegistry::add(const std::string& name, const Data& privateKey, int64_t accountNumber, int64_t sequence) {
+    auto account = std::make_shared<Account>(privateKey, accountNumber, sequence);
+    std::lock_guard<std::shared_timed_mutex> lock(mutex);
+    accounts[name] = account;
+    return account;
+}
+
+std::shared_ptr<Account> AccountRegistry::find(const std::string& name) const {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex);
+    auto it = accounts.find(name);
+    if (it == accounts.end()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+bool AccountRegistry::remove(const std::string& name) {
+    std::lock_guard<std::shared_timed_mutex> lock(mutex);
+    return accounts.erase(name) != 0;
+}
+
+size_t AccountRegistry::size() const {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex);
+    return accounts.size();
+}
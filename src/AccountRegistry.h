@@ -0,0 +1,105 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include "Data.h"
+#include "FixedData.h"
+
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+
+namespace Binance {
+
+/// Signing account whose sequence numbers can be reserved concurrently.
+///
+/// Sequence numbers are handed out with an atomic fetch-add, so any number of threads holding the account can build
+/// and sign transactions for it without locking.
+class Account {
+public:
+    /// Private signing key.
+    const PrivateKey privateKey;
+
+    /// Compressed public key, derived once from the private key so signers don't derive it per transaction.
+    const PublicKey publicKey;
+
+    /// Account number.
+    const int64_t accountNumber;
+
+    /// Initializes an account with the next sequence number to use.
+    ///
+    /// \throws std::invalid_argument if `privateKey` is not a 32-byte key.
+    Account(const Data& privateKey, int64_t accountNumber, int64_t sequence);
+
+    /// Reserves the next sequence number.
+    int64_t nextSequence() { return next.fetch_add(1, std::memory_order_relaxed); }
+
+    /// Sequence number the next reservation will return.
+    int64_t sequence() const { return next.load(std::memory_order_relaxed); }
+
+    /// Releases a reserved sequence number that was never broadcast.
+    ///
+    /// \returns `false` if a later number was reserved in the meantime, in which case the account must be resynced.
+    bool rollback(int64_t sequence) {
+        auto expected = sequence + 1;
+        return next.compare_exchange_strong(expected, sequence, std::memory_order_relaxed);
+    }
+
+    /// Marks the account as needing a resync, after a reserved sequence number could not be released.
+    void markForResync() { stale.store(true, std::memory_order_relaxed); }
+
+    /// Whether a sequence number was skipped since the last resync, so later transactions will be rejected.
+    bool needsResync() const { return stale.load(std::memory_order_relaxed); }
+
+    /// Resets the sequence number, typically to the value reported by the chain after a rejected broadcast.
+    void resync(int64_t sequence) {
+        next.store(sequence, std::memory_order_relaxed);
+        stale.store(false, std::memory_order_relaxed);
+    }
+
+private:
+    // Keep the counter on its own cache line so reservations don't invalidate the read-only fields.
+    char padding[64];
+    std::atomic<int64_t> next;
+    char trailing[64 - sizeof(std::atomic<int64_t>)];
+    std::atomic<bool> stale{false};
+};
+
+/// Registry of accounts by name.
+///
+/// Lookups take a shared lock; hot paths should keep the returned handle and reserve sequence numbers through it.
+class AccountRegistry {
+public:
+    /// Registers an account, replacing any account with the same name.
+    ///
+    /// \returns the account handle.
+    /// \throws std::invalid_argument if `privateKey` is not a 32-byte key.
+    std::shared_ptr<Account> add(const std::string& name, const Data& privateKey, int64_t accountNumber, int64_t sequence);
+
+    /// Finds an account.
+    ///
+    /// \returns the account handle or `nullptr` if the account is not registered.
+    std::shared_ptr<Account> find(const std::string& name) const;
+
+    /// Removes an account, existing handles stay valid.
+    ///
+    /// \returns `false` if the account is not registered.
+    bool remove(const std::string& name);
+
+    /// Number of registered accounts.
+    size_t size() const;
+
+private:
+    mutable std::shared_timed_mutex mutex;
+    std::unordered_map<std::string, std::shared_ptr<Account>> accounts;
+};
+
+} // namespace
@@ -9,57 +9,56 @@
 #include "Address.h"
 
 #include "Bech32.h"
-#include "Data.h"
 #include "crypto/ecdsa.h"
 
 using namespace Binance;
 
-bool Address::isValid(const std::string& addr) {
-    auto dec = Bech32::decode(addr);
-    if (dec.second.empty()) {
+bool Address::isValid(StringSpan addr) {
+    auto hrp = std::string();
+    byte values[Bech32::maxLength];
+    size_t size;
+    if (!Bech32::decode(addr, hrp, values, size) || size == 0) {
         return false;
     }
 
-    Data conv;
-    if (!Bech32::convertBits<5, 8, false>(conv, Data(dec.second.begin() + 1, dec.second.end())) ||
-        conv.size() < 2 || conv.size() > 40 || dec.second[0] > 16 || (dec.second[0] == 0 &&
-        conv.size() != 20 && conv.size() != 32)) {
+    byte conv[Bech32::maxLength];
+    auto end = conv;
+    const auto convSize = [&] { return static_cast<size_t>(end - conv); };
+    if (!Bech32::convertBits<5, 8, false>(end, ByteSpan(values + 1, size - 1)) ||
+        convSize() < 2 || convSize() > 40 || values[0] > 16 || (values[0] == 0 &&
+        convSize() != 20 && convSize() != 32)) {
         return false;
     }
 
     return true;
 }
 
-std::pair<Address, bool> Address::decode(const std::string& addr) {
-    auto dec = Bech32::decode(addr);
-    if (dec.second.empty()) {
+std::pair<Address, bool> Address::decode(StringSpan addr) {
+    auto hrp = std::string();
+    byte values[Bech32::maxLength];
+    size_t size;
+    if (!Bech32::decode(addr, hrp, values, size) || (hrp != binanceHRP && hrp != binanceTestHRP)) {
         return std::make_pair(Address(), false);
     }
 
-    bool test;
-    if (dec.first == "bnb") {
-        test = false;
-    } else if (dec.first == "tbnb") {
-        test = true;
-    } else {
+    // Exactly the number of values that carry a key hash, so the conversion can't overrun it.
+    if (size != (KeyHash::size() * 8 + 4) / 5) {
         return std::make_pair(Address(), false);
     }
-
-    Data conv;
-    auto success = Bech32::convertBits<5, 8, false>(conv, Data(dec.second.begin(), dec.second.end()));
-    if (!success || conv.size() < 2 || conv.size() > 40) {
+    auto keyHash = KeyHash();
+    auto end = keyHash.data();
+    if (!Bech32::convertBits<5, 8, false>(end, ByteSpan(values, size))) {
         return std::make_pair(Address(), false);
     }
 
-    return std::make_pair(Address(dec.first, std::move(conv)), true);
+    return std::make_pair(Address(hrp, keyHash), true);
 }
 
 std::string Address::encode() const {
-    Data enc;
-    Bech32::convertBits<8, 5, true>(enc, keyHash);
-    std::string result = Bech32::encode(hrp, enc);
-    if (!decode(result).second) {
+    if (hrp != binanceHRP && hrp != binanceTestHRP) {
         return {};
     }
-    return result;
+    // Sized for the longer of the two human-readable parts, "tbnb".
+    char encoded[Bech32::encodedSize(4, KeyHash::size())];
+    return std::string(encoded, Bech32::encode(hrp.data(), hrp.size(), keyHash.data(), keyHash.size(), encoded));
 }
@@ -7,7 +7,8 @@
 
 #pragma once
 
-#include "Data.h"
+#include "FixedData.h"
+#include "Span.h"
 
 #include <stdint.h>
 #include <string>
@@ -26,21 +27,27 @@ public:
     std::string hrp;
 
     /// Public key hash.
-    Data keyHash;
+    KeyHash keyHash;
 
     /// Determines whether a string makes a valid Tendermint address.
-    static bool isValid(const std::string& string);
+    static bool isValid(StringSpan string);
+
+    static bool isValid(const std::string& string) { return isValid(StringSpan(string)); }
 
     /// Initializes an address with a key hash.
-    Address(const std::string& hrp, const Data& keyHash) : hrp(hrp), keyHash(keyHash) {}
+    Address(const std::string& hrp, const KeyHash& keyHash) : hrp(hrp), keyHash(keyHash) {}
 
     /// Initializes an address with a key hash.
-    Address(const std::string& hrp, Data&& keyHash) : hrp(hrp), keyHash(keyHash) {}
+    ///
+    /// \throws std::invalid_argument if the key hash is not 20 bytes.
+    Address(const std::string& hrp, const Data& keyHash) : hrp(hrp), keyHash(keyHash) {}
 
     /// Decodes an address.
     ///
-    /// \returns a pair with the address and a success flag.
-    static std::pair<Address, bool> decode(const std::string& addr);
+    /// \returns a pair with the address and a success flag, which is `false` unless the key hash is 20 bytes.
+    static std::pair<Address, bool> decode(StringSpan addr);
+
+    static std::pair<Address, bool> decode(const std::string& addr) { return decode(StringSpan(addr)); }
 
     /// Encodes the address.
     ///
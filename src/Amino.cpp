@@ -0,0 +1,156 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Amino.h"
+
+#include <algorithm>
+
+using namespace Binance;
+
+const Data Amino::sendOrderPrefix = Data{ 0x2A, 0x2C, 0x87, 0xFA };
+const Data Amino::tradeOrderPrefix = Data{ 0xCE, 0x6D, 0xC0, 0x43 };
+const Data Amino::cancelTradeOrderPrefix = Data{ 0x16, 0x6E, 0x68, 0x1B };
+const Data Amino::tokenFreezeOrderPrefix = Data{ 0xE7, 0x74, 0xB3, 0x2D };
+const Data Amino::tokenUnfreezeOrderPrefix = Data{ 0x65, 0x15, 0xFF, 0x0D };
+const Data Amino::pubKeyPrefix = Data{ 0xEB, 0x5A, 0xE9, 0x87 };
+const Data Amino::transactionPrefix = Data{ 0xF0, 0x62, 0x5D, 0xEE };
+
+Data Amino::wrap(ByteSpan raw, ByteSpan typePrefix, bool prefixWithSize) {
+    const auto contentsSize = raw.size() + typePrefix.size();
+    auto result = Data(prefixWithSize ? varintSize(contentsSize) + contentsSize : contentsSize);
+    auto out = result.data();
+    if (prefixWithSize) {
+        out = writeVarint(out, contentsSize);
+    }
+    out = std::copy(typePrefix.begin(), typePrefix.end(), out);
+    std::copy(raw.begin(), raw.end(), out);
+    return result;
+}
+
+#ifndef BINANCE_NO_PROTOBUF
+const Data* Amino::orderPrefix(const ::google::protobuf::Message& order) {
+    const auto descriptor = order.GetDescriptor();
+    if (descriptor == NewOrder::descriptor()) {
+        return &tradeOrderPrefix;
+    } else if (descriptor == CancelOrder::descriptor()) {
+        return &cancelTradeOrderPrefix;
+    } else if (descriptor == Send::descriptor()) {
+        return &sendOrderPrefix;
+    } else if (descriptor == TokenFreeze::descriptor()) {
+        return &tokenFreezeOrderPrefix;
+    } else if (descriptor == TokenUnfreeze::descriptor()) {
+        return &tokenUnfreezeOrderPrefix;
+    }
+    return nullptr;
+}
+
+Data Amino::wrap(const ::google::protobuf::Message& message, ByteSpan typePrefix, bool prefixWithSize) {
+    const auto size = message.ByteSizeLong();
+    const auto contentsSize = size + typePrefix.size();
+    auto result = Data(prefixWithSize ? varintSize(contentsSize) + contentsSize : contentsSize);
+    auto out = result.data();
+    if (prefixWithSize) {
+        out = writeVarint(out, contentsSize);
+    }
+    out = std::copy(typePrefix.begin(), typePrefix.end(), out);
+    message.SerializeWithCachedSizesToArray(out);
+    return result;
+}
+
+Data Amino::encodeOrder(const ::google::protobuf::Message& order) {
+    const auto prefix = orderPrefix(order);
+    if (prefix == nullptr) {
+        return {};
+    }
+    return wrap(order, *prefix, false);
+}
+
+#endif
+
+Data Amino::encodeSignature(const PublicKey& publicKey, const Signature64& signature, int64_t accountNumber, int64_t sequence) {
+    auto encoded = Data(signatureEncodedSize(accountNumber, sequence));
+    writeSignature(encoded.data(), publicKey, signature, accountNumber, sequence);
+    return encoded;
+}
+
+byte* Amino::writeVarint(byte* out, uint64_t value) {
+    while (value >= 0x80) {
+        *out++ = static_cast<byte>(value | 0x80);
+        value >>= 7;
+    }
+    *out++ = static_cast<byte>(value);
+    return out;
+}
+
+byte* Amino::writeField(byte* out, uint32_t number, ByteSpan bytes) {
+    *out++ = static_cast<byte>(number << 3 | 2);
+    out = writeVarint(out, bytes.size());
+    return std::copy(bytes.begin(), bytes.end(), out);
+}
+
+byte* Amino::writeSignature(byte* out, const PublicKey& publicKey, const Signature64& signature, int64_t accountNumber, int64_t sequence) {
+    *out++ = 1 << 3 | 2;
+    out = writeVarint(out, pubKeyPrefix.size() + 1 + publicKey.size());
+    out = std::copy(pubKeyPrefix.begin(), pubKeyPrefix.end(), out);
+    *out++ = static_cast<byte>(publicKey.size());
+    out = std::copy(publicKey.begin(), publicKey.end(), out);
+    out = writeField(out, 2, signature);
+    if (accountNumber != 0) {
+        *out++ = 3 << 3;
+        out = writeVarint(out, static_cast<uint64_t>(accountNumber));
+    }
+    if (sequence != 0) {
+        *out++ = 4 << 3;
+        out = writeVarint(out, static_cast<uint64_t>(sequence));
+    }
+    return out;
+}
+
+size_t Amino::signatureEncodedSize(int64_t accountNumber, int64_t sequence) {
+    auto size = fieldSize(pubKeyPrefix.size() + 1 + publicKeySize) + fieldSize(signatureSize);
+    if (accountNumber != 0) {
+        size += 1 + varintSize(static_cast<uint64_t>(accountNumber));
+    }
+    if (sequence != 0) {
+        size += 1 + varintSize(static_cast<uint64_t>(sequence));
+    }
+    return size;
+}
+
+Data Amino::encodeTransaction(Span<const Data> msgs, ByteSpan signature, const std::string& memo, int64_t source) {
+    size_t msgsSize = 0;
+    for (auto& msg : msgs) {
+        msgsSize += fieldSize(msg.size());
+    }
+    const auto contentsSize = transactionContentsSize(msgsSize, signature.size(), memo, source);
+    auto transaction = Data(varintSize(contentsSize) + contentsSize);
+    auto out = writeVarint(transaction.data(), contentsSize);
+    out = std::copy(transactionPrefix.begin(), transactionPrefix.end(), out);
+    for (auto& msg : msgs) {
+        out = writeField(out, 1, msg);
+    }
+    out = writeField(out, 2, signature);
+    out = writeBytesField(out, 3, ByteSpan(reinterpret_cast<const byte*>(memo.data()), memo.size()));
+    writeIntField(out, 4, source);
+    return transaction;
+}
+
+size_t Amino::transactionEncodedSize(size_t msgsSize, size_t encodedSignatureSize, const std::string& memo, int64_t source) {
+    const auto size = transactionContentsSize(msgsSize, encodedSignatureSize, memo, source);
+    return varintSize(size) + size;
+}
+
+size_t Amino::transactionContentsSize(size_t msgsSize, size_t encodedSignatureSize, const std::string& memo, int64_t source) {
+    auto size = transactionPrefix.size() + msgsSize + fieldSize(encodedSignatureSize);
+    if (!memo.empty()) {
+        size += fieldSize(memo.size());
+    }
+    if (source != 0) {
+        size += 1 + varintSize(static_cast<uint64_t>(source));
+    }
+    return size;
+}
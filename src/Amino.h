@@ -0,0 +1,126 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#ifndef BINANCE_NO_PROTOBUF
+#include "dex.pb.h"
+#endif
+#include "Data.h"
+#include "FixedData.h"
+#include "Span.h"
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace Binance {
+namespace Amino {
+
+/// Message prefixes
+extern const Data sendOrderPrefix;
+extern const Data tradeOrderPrefix;
+extern const Data cancelTradeOrderPrefix;
+extern const Data tokenFreezeOrderPrefix;
+extern const Data tokenUnfreezeOrderPrefix;
+extern const Data pubKeyPrefix;
+extern const Data transactionPrefix;
+
+/// Size of a compressed secp256k1 public key.
+static constexpr size_t publicKeySize = 33;
+
+/// Size of a compact ECDSA signature.
+static constexpr size_t signatureSize = 64;
+
+/// Returns the number of bytes needed to encode a value as a varint.
+inline size_t varintSize(uint64_t value) {
+    size_t size = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        size += 1;
+    }
+    return size;
+}
+
+/// Returns the encoded size of a length-delimited field with a one-byte tag.
+inline size_t fieldSize(size_t length) {
+    return 1 + varintSize(length) + length;
+}
+
+/// Returns the encoded size of a proto3 integer field with a one-byte tag, zero for the default value.
+inline size_t intFieldSize(int64_t value) {
+    return value == 0 ? 0 : 1 + varintSize(static_cast<uint64_t>(value));
+}
+
+/// Returns the encoded size of a proto3 string or bytes field with a one-byte tag, zero if it is empty.
+inline size_t bytesFieldSize(size_t length) {
+    return length == 0 ? 0 : fieldSize(length);
+}
+
+/// Wraps raw protobuf bytes with an Amino type prefix and optional length prefix.
+Data wrap(ByteSpan raw, ByteSpan typePrefix, bool prefixWithSize);
+
+inline Data wrap(const std::string& raw, const Data& typePrefix, bool prefixWithSize) {
+    return wrap(ByteSpan(reinterpret_cast<const byte*>(raw.data()), raw.size()), typePrefix, prefixWithSize);
+}
+
+#ifndef BINANCE_NO_PROTOBUF
+/// Returns the Amino type prefix for an order.
+///
+/// \returns the prefix or `nullptr` if the order type is not supported.
+const Data* orderPrefix(const ::google::protobuf::Message& order);
+
+/// Serializes a message directly into its Amino wrapping, the same bytes as `wrap` of the serialized message.
+Data wrap(const ::google::protobuf::Message& message, ByteSpan typePrefix, bool prefixWithSize);
+
+/// Encodes an order with its Amino type prefix.
+///
+/// \returns the encoded order or an empty vector if the order type is not supported.
+Data encodeOrder(const ::google::protobuf::Message& order);
+#endif
+
+/// Encodes the standard signature structure for a compressed public key.
+Data encodeSignature(const PublicKey& publicKey, const Signature64& signature, int64_t accountNumber, int64_t sequence);
+
+/// Returns the size of `encodeSignature` output without encoding it.
+size_t signatureEncodedSize(int64_t accountNumber, int64_t sequence);
+
+/// Writes a protobuf varint, returning the position after it.
+byte* writeVarint(byte* out, uint64_t value);
+
+/// Writes a length-delimited field with a one-byte tag, returning the position after it.
+byte* writeField(byte* out, uint32_t number, ByteSpan bytes);
+
+/// Writes a proto3 integer field with a one-byte tag unless it is zero, returning the position after it.
+inline byte* writeIntField(byte* out, uint32_t number, int64_t value) {
+    if (value == 0) {
+        return out;
+    }
+    *out++ = static_cast<byte>(number << 3);
+    return writeVarint(out, static_cast<uint64_t>(value));
+}
+
+/// Writes a proto3 string or bytes field with a one-byte tag unless it is empty, returning the position after it.
+inline byte* writeBytesField(byte* out, uint32_t number, ByteSpan bytes) {
+    return bytes.empty() ? out : writeField(out, number, bytes);
+}
+
+/// Writes the standard signature structure of `encodeSignature`, `signatureEncodedSize` bytes.
+///
+/// \returns the position after the structure.
+byte* writeSignature(byte* out, const PublicKey& publicKey, const Signature64& signature, int64_t accountNumber, int64_t sequence);
+
+/// Encodes a transaction from encoded messages and an encoded signature.
+Data encodeTransaction(Span<const Data> msgs, ByteSpan signature, const std::string& memo, int64_t source);
+
+/// Returns the size of `encodeTransaction` output given the total size of the `msgs` fields.
+size_t transactionEncodedSize(size_t msgsSize, size_t encodedSignatureSize, const std::string& memo, int64_t source);
+
+/// Returns the size of a transaction after its length prefix, from the type prefix on.
+size_t transactionContentsSize(size_t msgsSize, size_t encodedSignatureSize, const std::string& memo, int64_t source);
+
+}} // namespace
@@ -0,0 +1,46 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Arena.h"
+
+#include <algorithm>
+#include <stdint.h>
+
+using namespace Binance;
+
+Arena::Arena(size_t blockSize) {
+    blockSize = std::max<size_t>(blockSize, 64);
+    blocks.push_back(Block{std::unique_ptr<byte[]>(new byte[blockSize]), blockSize});
+    reserved = blockSize;
+}
+
+void* Arena::allocate(size_t size, size_t alignment) {
+    while (true) {
+        auto& block = blocks[current];
+        const auto base = reinterpret_cast<uintptr_t>(block.data.get());
+        const auto aligned = (base + offset + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+        const auto start = static_cast<size_t>(aligned - base);
+        if (start <= block.size && size <= block.size - start) {
+            offset = start + size;
+            return block.data.get() + start;
+        }
+        usedBefore += block.size;
+        offset = 0;
+        current += 1;
+        if (current == blocks.size()) {
+            const auto blockSize = std::max(blocks.back().size * 2, size + alignment);
+            blocks.push_back(Block{std::unique_ptr<byte[]>(new byte[blockSize]), blockSize});
+            reserved += blockSize;
+        }
+    }
+}
+
+void Arena::reset() noexcept {
+    current = 0;
+    offset = 0;
+    usedBefore = 0;
+}
@@ -0,0 +1,93 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include "Data.h"
+
+#include <cstddef>
+#include <memory>
+#include <stddef.h>
+#include <vector>
+
+namespace Binance {
+
+/// Bump allocator for per-transaction scratch memory and output.
+///
+/// Allocations advance a pointer through blocks of memory and are never freed one by one; `reset` releases all of
+/// them in constant time and keeps the blocks, so an arena reused for every transaction stops touching the heap once
+/// its blocks are large enough. Not thread-safe, use one arena per thread.
+class Arena {
+public:
+    /// Initializes an arena with a first block of `blockSize` bytes.
+    explicit Arena(size_t blockSize = 4096);
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /// Allocates `size` bytes aligned to `alignment`, which must be a power of two.
+    ///
+    /// Adds a block, at least twice as large as the previous one, when the remaining blocks are too small.
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /// Releases all allocations, invalidating memory handed out since the last reset.
+    void reset() noexcept;
+
+    /// Bytes allocated since the last reset, including alignment padding and space skipped at block ends.
+    size_t used() const { return usedBefore + offset; }
+
+    /// Total size of the blocks.
+    size_t capacity() const { return reserved; }
+
+private:
+    struct Block {
+        std::unique_ptr<byte[]> data;
+        size_t size;
+    };
+
+    std::vector<Block> blocks;
+
+    /// Block being allocated from, and the position in it.
+    size_t current = 0;
+    size_t offset = 0;
+
+    /// Size of the blocks before `current`.
+    size_t usedBefore = 0;
+    size_t reserved = 0;
+};
+
+/// Standard allocator drawing from an arena, for containers of per-transaction scratch data.
+///
+/// Deallocation does nothing, the memory is released with the arena.
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    ArenaAllocator(Arena& arena) noexcept : arena(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {}
+
+    T* allocate(size_t count) { return static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T))); }
+
+    void deallocate(T*, size_t) noexcept {}
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept { return arena == other.arena; }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept { return arena != other.arena; }
+
+private:
+    template <typename U>
+    friend class ArenaAllocator;
+
+    Arena* arena;
+};
+
+} // namespace
@@ -8,6 +8,8 @@
 
 #include "Bech32.h"
 
+#include <algorithm>
+
 using namespace Binance;
 
 namespace {
@@ -27,106 +29,142 @@ const int8_t charset_rev[128] = {
      1,  0,  3, 16, 11, 28, 12, 14,  6,  4,  2, -1, -1, -1, -1, -1
 };
 
-/** Concatenate two byte arrays. */
-Data cat(Data x, const Data& y) {
-    x.insert(x.end(), y.begin(), y.end());
-    return x;
-}
-
-/** Find the polynomial with value coefficients mod the generator as 30-bit. */
-uint32_t polymod(const Data& values) {
+/** Incrementally computes the polynomial of the values mod the generator, as 30-bit. */
+struct Checksum {
     uint32_t chk = 1;
-    for (size_t i = 0; i < values.size(); ++i) {
+
+    void step(uint8_t value) {
         uint8_t top = chk >> 25;
-        chk = (chk & 0x1ffffff) << 5 ^ values[i] ^
+        chk = (chk & 0x1ffffff) << 5 ^ value ^
             (-((top >> 0) & 1) & 0x3b6a57b2UL) ^
             (-((top >> 1) & 1) & 0x26508e6dUL) ^
             (-((top >> 2) & 1) & 0x1ea119faUL) ^
             (-((top >> 3) & 1) & 0x3d4233ddUL) ^
             (-((top >> 4) & 1) & 0x2a1462b3UL);
     }
-    return chk;
-}
+
+    /** Steps over the expanded HRP. */
+    void hrp(const char* hrp, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            step(static_cast<unsigned char>(hrp[i]) >> 5);
+        }
+        step(0);
+        for (size_t i = 0; i < size; ++i) {
+            step(hrp[i] & 0x1f);
+        }
+    }
+
+    /** Returns the i-th of the six checksum values once all data values were stepped over. */
+    uint8_t value(size_t i) const {
+        return ((chk ^ 1) >> (5 * (5 - i))) & 31;
+    }
+};
 
 /** Convert to lower case. */
 unsigned char lc(unsigned char c) {
     return (c >= 'A' && c <= 'Z') ? (c - 'A') + 'a' : c;
 }
 
-/** Expand a HRP for use in checksum computation. */
-Data expand_hrp(const std::string& hrp) {
-    Data ret;
-    ret.resize(hrp.size() * 2 + 1);
-    for (size_t i = 0; i < hrp.size(); ++i) {
-        unsigned char c = hrp[i];
-        ret[i] = c >> 5;
-        ret[i + hrp.size() + 1] = c & 0x1f;
-    }
-    ret[hrp.size()] = 0;
-    return ret;
-}
-
-/** Verify a checksum. */
-bool verify_checksum(const std::string& hrp, const Data& values) {
-    return polymod(cat(expand_hrp(hrp), values)) == 1;
-}
+} // namespace
 
-/** Create a checksum. */
-Data create_checksum(const std::string& hrp, const Data& values) {
-    Data enc = cat(expand_hrp(hrp), values);
-    enc.resize(enc.size() + 6);
-    uint32_t mod = polymod(enc) ^ 1;
-    Data ret;
-    ret.resize(6);
+/** Encode a Bech32 string. */
+std::string Bech32::encode(const std::string& hrp, ByteSpan values) {
+    auto checksum = Checksum();
+    checksum.hrp(hrp.data(), hrp.size());
+    std::string ret;
+    ret.reserve(hrp.size() + 1 + values.size() + 6);
+    ret += hrp;
+    ret += '1';
+    for (auto value : values) {
+        checksum.step(value);
+        ret += charset[value];
+    }
     for (size_t i = 0; i < 6; ++i) {
-        ret[i] = (mod >> (5 * (5 - i))) & 31;
+        checksum.step(0);
+    }
+    for (size_t i = 0; i < 6; ++i) {
+        ret += charset[checksum.value(i)];
     }
     return ret;
 }
 
-} // namespace
+size_t Bech32::encode(const char* hrp, size_t hrpSize, const byte* data, size_t size, char* out) {
+    auto checksum = Checksum();
+    checksum.hrp(hrp, hrpSize);
+    auto length = std::copy(hrp, hrp + hrpSize, out) - out;
+    out[length++] = '1';
 
-/** Encode a Bech32 string. */
-std::string Bech32::encode(const std::string& hrp, const Data& values) {
-    Data checksum = create_checksum(hrp, values);
-    Data combined = cat(values, checksum);
-    std::string ret = hrp + '1';
-    ret.reserve(ret.size() + combined.size());
-    for (size_t i = 0; i < combined.size(); ++i) {
-        ret += charset[combined[i]];
+    // Regroup into 5-bit values, padding the last one.
+    int acc = 0;
+    int bits = 0;
+    for (size_t i = 0; i < size; ++i) {
+        acc = ((acc << 8) | data[i]) & 0xfff;
+        bits += 8;
+        while (bits >= 5) {
+            bits -= 5;
+            const auto value = (acc >> bits) & 31;
+            checksum.step(value);
+            out[length++] = charset[value];
+        }
     }
-    return ret;
+    if (bits) {
+        const auto value = (acc << (5 - bits)) & 31;
+        checksum.step(value);
+        out[length++] = charset[value];
+    }
+
+    for (size_t i = 0; i < 6; ++i) {
+        checksum.step(0);
+    }
+    for (size_t i = 0; i < 6; ++i) {
+        out[length++] = charset[checksum.value(i)];
+    }
+    return static_cast<size_t>(length);
 }
 
 /** Decode a Bech32 string. */
-std::pair<std::string, Data> Bech32::decode(const std::string& str) {
+bool Bech32::decode(StringSpan str, std::string& hrp, byte* values, size_t& size) {
     bool lower = false, upper = false;
-    bool ok = true;
-    for (size_t i = 0; ok && i < str.size(); ++i) {
+    for (size_t i = 0; i < str.size(); ++i) {
         unsigned char c = str[i];
-        if (c < 33 || c > 126) ok = false;
+        if (c < 33 || c > 126) return false;
         if (c >= 'a' && c <= 'z') lower = true;
         if (c >= 'A' && c <= 'Z') upper = true;
     }
-    if (lower && upper) ok = false;
-    size_t pos = str.rfind('1');
-    if (ok && str.size() <= 90 && pos != str.npos && pos >= 1 && pos + 7 <= str.size()) {
-        Data values;
-        values.resize(str.size() - 1 - pos);
-        for (size_t i = 0; i < str.size() - 1 - pos; ++i) {
-            unsigned char c = str[i + pos + 1];
-            if (charset_rev[c] == -1) ok = false;
-            values[i] = charset_rev[c];
-        }
-        if (ok) {
-            std::string hrp;
-            for (size_t i = 0; i < pos; ++i) {
-                hrp += lc(str[i]);
-            }
-            if (verify_checksum(hrp, values)) {
-                return std::make_pair(hrp, Data(values.begin(), values.end() - 6));
-            }
+    if (lower && upper) return false;
+    auto pos = str.size();
+    while (pos > 0 && str[pos - 1] != '1') {
+        --pos;
+    }
+    // `pos` is one past the separator.
+    if (str.size() > maxLength || pos < 2 || pos + 6 > str.size()) {
+        return false;
+    }
+
+    hrp.resize(pos - 1);
+    for (size_t i = 0; i < pos - 1; ++i) {
+        hrp[i] = lc(str[i]);
+    }
+    auto checksum = Checksum();
+    checksum.hrp(hrp.data(), hrp.size());
+    size = str.size() - pos - 6;
+    for (size_t i = pos; i < str.size(); ++i) {
+        unsigned char c = str[i];
+        if (charset_rev[c] == -1) return false;
+        checksum.step(charset_rev[c]);
+        if (i - pos < size) {
+            values[i - pos] = charset_rev[c];
         }
     }
-    return std::make_pair(std::string(), Data());
+    return checksum.chk == 1;
+}
+
+std::pair<std::string, Data> Bech32::decode(StringSpan str) {
+    auto hrp = std::string();
+    byte values[maxLength];
+    size_t size;
+    if (!decode(str, hrp, values, size)) {
+        return std::make_pair(std::string(), Data());
+    }
+    return std::make_pair(std::move(hrp), Data(values, values + size));
 }
@@ -6,8 +6,12 @@
 // redistribution, is contained in the file LICENSE at the root of the source
 // code distribution tree.
 
+#pragma once
+
 #include "Data.h"
+#include "Span.h"
 
+#include <iterator>
 #include <stdint.h>
 #include <vector>
 #include <string>
@@ -15,19 +19,47 @@
 namespace Binance {
 namespace Bech32 {
 
-/// Encodes a Bech32 string.
+/// Maximum length of a Bech32 string.
+static constexpr size_t maxLength = 90;
+
+/// Encodes a Bech32 string from 5-bit values.
 ///
 /// \returns the encoded string, or an empty string in case of failure.
-std::string encode(const std::string& hrp, const Data& values);
+std::string encode(const std::string& hrp, ByteSpan values);
+
+/// Encodes bytes as a Bech32 string without allocating.
+///
+/// \param out buffer of at least `encodedSize(hrpSize, size)` characters.
+/// \returns the number of characters written.
+size_t encode(const char* hrp, size_t hrpSize, const byte* data, size_t size, char* out);
+
+/// Returns the length of the Bech32 string encoding `size` bytes.
+constexpr size_t encodedSize(size_t hrpSize, size_t size) {
+    return hrpSize + 1 + (size * 8 + 4) / 5 + 6;
+}
 
 /// Decodes a Bech32 string.
 ///
 /// \returns a pair with the human-readable part and the data, or a pair or empty collections on failure.
-std::pair<std::string, Data> decode(const std::string& str);
+std::pair<std::string, Data> decode(StringSpan str);
 
-/// Converts from one power-of-2 number base to another.
-template<int frombits, int tobits, bool pad>
-inline bool convertBits(Data& out, const Data& in) {
+inline std::pair<std::string, Data> decode(const std::string& str) {
+    return decode(StringSpan(str));
+}
+
+/// Decodes a Bech32 string into caller-provided storage.
+///
+/// \param hrp receives the lowercased human-readable part, unspecified on failure.
+/// \param values buffer of at least `maxLength` bytes, receives the 5-bit values without the checksum.
+/// \param size receives the number of values.
+/// \returns `false` if the string is not valid Bech32.
+bool decode(StringSpan str, std::string& hrp, byte* values, size_t& size);
+
+/// Converts from one power-of-2 number base to another, writing through an output iterator.
+///
+/// \param out iterator advanced past the last value written.
+template<int frombits, int tobits, bool pad, typename OutputIterator>
+inline bool convertBits(OutputIterator& out, ByteSpan in) {
     int acc = 0;
     int bits = 0;
     const int maxv = (1 << tobits) - 1;
@@ -38,15 +70,22 @@ inline bool convertBits(Data& out, const Data& in) {
         bits += frombits;
         while (bits >= tobits) {
             bits -= tobits;
-            out.push_back((acc >> bits) & maxv);
+            *out++ = (acc >> bits) & maxv;
         }
     }
     if (pad) {
-        if (bits) out.push_back((acc << (tobits - bits)) & maxv);
+        if (bits) *out++ = (acc << (tobits - bits)) & maxv;
     } else if (bits >= frombits || ((acc << (tobits - bits)) & maxv)) {
         return false;
     }
     return true;
 }
 
+/// Converts from one power-of-2 number base to another, appending to `out`.
+template<int frombits, int tobits, bool pad>
+inline bool convertBits(Data& out, ByteSpan in) {
+    auto inserter = std::back_inserter(out);
+    return convertBits<frombits, tobits, pad>(inserter, in);
+}
+
 }} // namespace
@@ -0,0 +1,267 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Decoder.h"
+#include "Amino.h"
+
+#include <cstring>
+
+using namespace Binance;
+using namespace Binance::Amino;
+
+static inline bool readBytes(const WireReader& reader, ByteSpan& value) {
+    if (reader.wireType() != WireReader::bytesType) {
+        return false;
+    }
+    value = reader.bytes();
+    return true;
+}
+
+static inline bool readString(const WireReader& reader, StringSpan& value) {
+    if (reader.wireType() != WireReader::bytesType) {
+        return false;
+    }
+    const auto bytes = reader.bytes();
+    value = StringSpan(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    return true;
+}
+
+static inline bool readInt(const WireReader& reader, int64_t& value) {
+    if (reader.wireType() != WireReader::varintType) {
+        return false;
+    }
+    value = static_cast<int64_t>(reader.varint());
+    return true;
+}
+
+/// Validates a repeated message field element and counts it.
+template <typename View>
+static inline bool readRepeated(const WireReader& reader, size_t& count) {
+    View element;
+    if (reader.wireType() != WireReader::bytesType || !View::decode(reader.bytes(), element)) {
+        return false;
+    }
+    count += 1;
+    return true;
+}
+
+static inline bool hasPrefix(ByteSpan data, const Data& prefix) {
+    return data.size() >= prefix.size() && std::memcmp(data.data(), prefix.data(), prefix.size()) == 0;
+}
+
+bool TokenView::decode(ByteSpan data, TokenView& view) {
+    view = TokenView();
+    auto reader = WireReader(data);
+    while (reader.next()) {
+        auto valid = true;
+        switch (reader.field()) {
+        case 1: valid = readString(reader, view.denom); break;
+        case 2: valid = readInt(reader, view.amount); break;
+        }
+        if (!valid) {
+            return false;
+        }
+    }
+    return !reader.failed();
+}
+
+bool SendEntryView::decode(ByteSpan data, SendEntryView& view) {
+    view = SendEntryView();
+    size_t coins = 0;
+    auto reader = WireReader(data);
+    while (reader.next()) {
+        auto valid = true;
+        switch (reader.field()) {
+        case 1: valid = readBytes(reader, view.address); break;
+        case 2: valid = readRepeated<TokenView>(reader, coins); break;
+        }
+        if (!valid) {
+            return false;
+        }
+    }
+    view.coins = RepeatedView<TokenView>(data, 2, coins);
+    return !reader.failed();
+}
+
+bool SendView::decode(ByteSpan data, SendView& view) {
+    view = SendView();
+    size_t inputs = 0;
+    size_t outputs = 0;
+    auto reader = WireReader(data);
+    while (reader.next()) {
+        auto valid = true;
+        switch (reader.field()) {
+        case 1: valid = readRepeated<SendEntryView>(reader, inputs); break;
+        case 2: valid = readRepeated<SendEntryView>(reader, outputs); break;
+        }
+        if (!valid) {
+            return false;
+        }
+    }
+    view.inputs = RepeatedView<SendEntryView>(data, 1, inputs);
+    view.outputs = RepeatedView<SendEntryView>(data, 2, outputs);
+    return !reader.failed();
+}
+
+bool NewOrderView::decode(ByteSpan data, NewOrderView& view) {
+    view = NewOrderView();
+    auto reader = WireReader(data);
+    while (reader.next()) {
+        auto valid = true;
+        switch (reader.field()) {
+        case 1: valid = readBytes(reader, view.sender); break;
+        case 2: valid = readString(reader, view.id); break;
+        case 3: valid = readString(reader, view.symbol); break;
+        case 4: valid = readInt(reader, view.ordertype); break;
+        case 5: valid = readInt(reader, view.side); break;
+        case 6: valid = readInt(reader, view.price); break;
+        case 7: valid = readInt(reader, view.quantity); break;
+        case 8: valid = readInt(reader, view.timeinforce); break;
+        }
+        if (!valid) {
+            return false;
+        }
+    }
+    return !reader.failed();
+}
+
+bool CancelOrderView::decode(ByteSpan data, CancelOrderView& view) {
+    view = CancelOrderView();
+    auto reader = WireReader(data);
+    while (reader.next()) {
+        auto valid = true;
+        switch (reader.field()) {
+        case 1: valid = readBytes(reader, view.sender); break;
+        case 2: valid = readString(reader, view.symbol); break;
+        case 3: valid = readString(reader, view.refid); break;
+        }
+        if (!valid) {
+            return false;
+        }
+    }
+    return !reader.failed();
+}
+
+bool TokenFreezeView::decode(ByteSpan data, TokenFreezeView& view) {
+    view = TokenFreezeView();
+    auto reader = WireReader(data);
+    while (reader.next()) {
+        auto valid = true;
+        switch (reader.field()) {
+        case 1: valid = readBytes(reader, view.from); break;
+        case 2: valid = readString(reader, view.symbol); break;
+        case 3: valid = readInt(reader, view.amount); break;
+        }
+        if (!valid) {
+            return false;
+        }
+    }
+    return !reader.failed();
+}
+
+bool MessageView::decode(ByteSpan data, MessageView& view) {
+    view = MessageView();
+    if (hasPrefix(data, tradeOrderPrefix)) {
+        view.type = Type::newOrder;
+        view.body = data.subspan(tradeOrderPrefix.size());
+        NewOrderView order;
+        return NewOrderView::decode(view.body, order);
+    } else if (hasPrefix(data, cancelTradeOrderPrefix)) {
+        view.type = Type::cancelOrder;
+        view.body = data.subspan(cancelTradeOrderPrefix.size());
+        CancelOrderView order;
+        return CancelOrderView::decode(view.body, order);
+    } else if (hasPrefix(data, sendOrderPrefix)) {
+        view.type = Type::send;
+        view.body = data.subspan(sendOrderPrefix.size());
+        SendView order;
+        return SendView::decode(view.body, order);
+    } else if (hasPrefix(data, tokenFreezeOrderPrefix)) {
+        view.type = Type::tokenFreeze;
+        view.body = data.subspan(tokenFreezeOrderPrefix.size());
+        TokenFreezeView order;
+        return TokenFreezeView::decode(view.body, order);
+    } else if (hasPrefix(data, tokenUnfreezeOrderPrefix)) {
+        view.type = Type::tokenUnfreeze;
+        view.body = data.subspan(tokenUnfreezeOrderPrefix.size());
+        TokenFreezeView order;
+        return TokenFreezeView::decode(view.body, order);
+    }
+    return false;
+}
+
+bool SignatureView::decode(ByteSpan data, SignatureView& view) {
+    view = SignatureView();
+    auto reader = WireReader(data);
+    while (reader.next()) {
+        auto valid = true;
+        switch (reader.field()) {
+        case 1: {
+            // Amino encoded key: type prefix, one byte length and the key.
+            ByteSpan key;
+            valid = readBytes(reader, key) && hasPrefix(key, pubKeyPrefix) && key.size() > pubKeyPrefix.size() &&
+                key[pubKeyPrefix.size()] == key.size() - pubKeyPrefix.size() - 1;
+            if (valid) {
+                view.publicKey = key.subspan(pubKeyPrefix.size() + 1);
+            }
+            break;
+        }
+        case 2: valid = readBytes(reader, view.signature); break;
+        case 3: valid = readInt(reader, view.accountNumber); break;
+        case 4: valid = readInt(reader, view.sequence); break;
+        }
+        if (!valid) {
+            return false;
+        }
+    }
+    return !reader.failed();
+}
+
+bool TransactionView::decode(ByteSpan data, TransactionView& view) {
+    view = TransactionView();
+    if (!hasPrefix(data, transactionPrefix)) {
+        return false;
+    }
+    const auto body = data.subspan(transactionPrefix.size());
+    size_t msgs = 0;
+    size_t signatures = 0;
+    auto reader = WireReader(body);
+    while (reader.next()) {
+        auto valid = true;
+        switch (reader.field()) {
+        case 1: valid = readRepeated<MessageView>(reader, msgs); break;
+        case 2: valid = readRepeated<SignatureView>(reader, signatures); break;
+        case 3: valid = readString(reader, view.memo); break;
+        case 4: valid = readInt(reader, view.source); break;
+        case 5: valid = readBytes(reader, view.data); break;
+        }
+        if (!valid) {
+            return false;
+        }
+    }
+    view.msgs = RepeatedView<MessageView>(body, 1, msgs);
+    view.signatures = RepeatedView<SignatureView>(body, 2, signatures);
+    view.encoded = data;
+    return !reader.failed();
+}
+
+bool Amino::decodeTransaction(ByteSpan data, TransactionView& view) {
+    auto reader = WireReader(data);
+    uint64_t size;
+    if (!reader.readVarint(size)) {
+        return false;
+    }
+    const auto prefixSize = static_cast<size_t>(reader.current() - data.data());
+    if (size > data.size() - prefixSize) {
+        return false;
+    }
+    if (!TransactionView::decode(data.subspan(prefixSize, static_cast<size_t>(size)), view)) {
+        return false;
+    }
+    view.encoded = data.subspan(0, prefixSize + static_cast<size_t>(size));
+    return true;
+}
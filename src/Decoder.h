@@ -0,0 +1,272 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include "Span.h"
+
+#include <iterator>
+#include <stdint.h>
+
+namespace Binance {
+namespace Amino {
+
+/// Reads protobuf fields from a buffer without copying them.
+class WireReader {
+public:
+    /// Protobuf wire types.
+    enum WireType { varintType = 0, fixed64Type = 1, bytesType = 2, fixed32Type = 5 };
+
+    explicit WireReader(ByteSpan data) : position(data.begin()), end(data.end()) {}
+
+    /// Reads the next field.
+    ///
+    /// \returns `false` at the end of the buffer or if the field is malformed, see `failed()`.
+    bool next() {
+        if (position == end) {
+            return false;
+        }
+        uint64_t key;
+        if (!readVarint(key) || (key >> 3) == 0 || (key >> 3) > UINT32_MAX) {
+            return fail();
+        }
+        number = static_cast<uint32_t>(key >> 3);
+        type = static_cast<int>(key & 7);
+        switch (type) {
+        case varintType:
+            return readVarint(integer) || fail();
+        case fixed64Type:
+            return skip(8);
+        case fixed32Type:
+            return skip(4);
+        case bytesType:
+            if (!readVarint(integer) || integer > static_cast<uint64_t>(end - position)) {
+                return fail();
+            }
+            payload = ByteSpan(position, static_cast<size_t>(integer));
+            position += integer;
+            return true;
+        default:
+            return fail();
+        }
+    }
+
+    /// Field number of the current field.
+    uint32_t field() const { return number; }
+
+    /// Wire type of the current field.
+    int wireType() const { return type; }
+
+    /// Value of the current varint field.
+    uint64_t varint() const { return integer; }
+
+    /// Contents of the current length-delimited field.
+    ByteSpan bytes() const { return payload; }
+
+    /// Whether reading stopped at a malformed field.
+    bool failed() const { return error; }
+
+    /// Start of the unread part of the buffer.
+    const byte* current() const { return position; }
+
+    /// Reads a varint at the current position, as used by the Amino length prefix.
+    bool readVarint(uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64 && position != end; shift += 7) {
+            const auto b = *position++;
+            value |= static_cast<uint64_t>(b & 0x7F) << shift;
+            if ((b & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    bool skip(size_t size) {
+        if (static_cast<size_t>(end - position) < size) {
+            return fail();
+        }
+        position += size;
+        return true;
+    }
+
+    bool fail() {
+        error = true;
+        position = end;
+        return false;
+    }
+
+    const byte* position;
+    const byte* end;
+    uint32_t number = 0;
+    int type = 0;
+    uint64_t integer = 0;
+    ByteSpan payload;
+    bool error = false;
+};
+
+/// Lazily decoded view of a repeated message field.
+///
+/// Elements are decoded while iterating. The field must have been validated when the enclosing view was decoded, so
+/// decoding an element cannot fail.
+template <typename View>
+class RepeatedView {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = View;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const View*;
+        using reference = const View&;
+
+        iterator() : reader(ByteSpan()), number(0), position(nullptr) {}
+        iterator(ByteSpan message, uint32_t number) : reader(message), number(number), position(nullptr) { advance(); }
+
+        reference operator*() const { return value; }
+        pointer operator->() const { return &value; }
+        iterator& operator++() { advance(); return *this; }
+        bool operator==(const iterator& other) const { return position == other.position; }
+        bool operator!=(const iterator& other) const { return position != other.position; }
+
+    private:
+        void advance() {
+            while (reader.next()) {
+                if (reader.field() == number) {
+                    position = reader.current();
+                    View::decode(reader.bytes(), value);
+                    return;
+                }
+            }
+            position = nullptr;
+        }
+
+        WireReader reader;
+        uint32_t number;
+        const byte* position;
+        View value;
+    };
+
+    RepeatedView() = default;
+    RepeatedView(ByteSpan message, uint32_t number, size_t count) : message(message), number(number), count(count) {}
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    iterator begin() const { return count == 0 ? iterator() : iterator(message, number); }
+    iterator end() const { return iterator(); }
+
+private:
+    ByteSpan message;
+    uint32_t number = 0;
+    size_t count = 0;
+};
+
+/// Coin amount of a `Send` input or output.
+struct TokenView {
+    StringSpan denom;
+    int64_t amount = 0;
+
+    static bool decode(ByteSpan data, TokenView& view);
+};
+
+/// Input or output of a `Send` order.
+struct SendEntryView {
+    ByteSpan address;
+    RepeatedView<TokenView> coins;
+
+    static bool decode(ByteSpan data, SendEntryView& view);
+};
+
+/// `Send` order.
+struct SendView {
+    RepeatedView<SendEntryView> inputs;
+    RepeatedView<SendEntryView> outputs;
+
+    static bool decode(ByteSpan data, SendView& view);
+};
+
+/// `NewOrder` order.
+struct NewOrderView {
+    ByteSpan sender;
+    StringSpan id;
+    StringSpan symbol;
+    int64_t ordertype = 0;
+    int64_t side = 0;
+    int64_t price = 0;
+    int64_t quantity = 0;
+    int64_t timeinforce = 0;
+
+    static bool decode(ByteSpan data, NewOrderView& view);
+};
+
+/// `CancelOrder` order.
+struct CancelOrderView {
+    ByteSpan sender;
+    StringSpan symbol;
+    StringSpan refid;
+
+    static bool decode(ByteSpan data, CancelOrderView& view);
+};
+
+/// `TokenFreeze` or `TokenUnfreeze` order.
+struct TokenFreezeView {
+    ByteSpan from;
+    StringSpan symbol;
+    int64_t amount = 0;
+
+    static bool decode(ByteSpan data, TokenFreezeView& view);
+};
+
+/// Transaction message, identified by its Amino type prefix.
+struct MessageView {
+    enum class Type { send, newOrder, cancelOrder, tokenFreeze, tokenUnfreeze };
+
+    Type type = Type::send;
+
+    /// Protobuf encoded order, without the type prefix.
+    ByteSpan body;
+
+    /// Decodes the type prefix, validating the body against the order type.
+    static bool decode(ByteSpan data, MessageView& view);
+};
+
+/// Standard signature structure.
+struct SignatureView {
+    /// Public key bytes, without the Amino type prefix and length.
+    ByteSpan publicKey;
+    ByteSpan signature;
+    int64_t accountNumber = 0;
+    int64_t sequence = 0;
+
+    static bool decode(ByteSpan data, SignatureView& view);
+};
+
+/// Signed transaction.
+struct TransactionView {
+    RepeatedView<MessageView> msgs;
+    RepeatedView<SignatureView> signatures;
+    StringSpan memo;
+    int64_t source = 0;
+    ByteSpan data;
+
+    /// Encoded transaction, including the length prefix.
+    ByteSpan encoded;
+
+    /// Decodes a transaction without the length prefix, starting at the type prefix.
+    static bool decode(ByteSpan data, TransactionView& view);
+};
+
+/// Decodes a length-prefixed transaction as produced by `Signer::build()`, validating every field.
+///
+/// The views point into `data`, which must outlive them. Trailing bytes after the transaction are not examined, so
+/// a buffer of concatenated transactions can be decoded by advancing by `view.encoded.size()`.
+///
+/// \returns `false` if the transaction is truncated or malformed.
+bool decodeTransaction(ByteSpan data, TransactionView& view);
+
+}} // namespace
@@ -0,0 +1,92 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include "Data.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+
+namespace Binance {
+
+/// Byte array of a size known at compile time, stored inline.
+///
+/// Used for keys, hashes and signatures, which as `Data` would each take a heap allocation. Converts implicitly to
+/// `Data` so fixed-size values can still be passed where `Data` is expected. Converting from `Data` is explicit, since
+/// it throws on a size mismatch.
+template <size_t N>
+class FixedData {
+public:
+    using value_type = byte;
+    using iterator = byte*;
+    using const_iterator = const byte*;
+
+    /// Initializes a value with all bytes zero.
+    FixedData() noexcept : bytes() {}
+
+    /// Copies `N` bytes from `data`.
+    explicit FixedData(const byte* data) noexcept { std::copy(data, data + N, bytes.begin()); }
+
+    /// Copies a `Data` value.
+    ///
+    /// \throws std::invalid_argument if `data` does not hold exactly `N` bytes.
+    explicit FixedData(const Data& data) {
+        if (data.size() != N) {
+            throw std::invalid_argument("Invalid data size");
+        }
+        std::copy(data.begin(), data.end(), bytes.begin());
+    }
+
+    operator Data() const { return Data(begin(), end()); }
+
+    static constexpr size_t size() noexcept { return N; }
+
+    byte* data() noexcept { return bytes.data(); }
+    const byte* data() const noexcept { return bytes.data(); }
+    iterator begin() noexcept { return bytes.data(); }
+    iterator end() noexcept { return bytes.data() + N; }
+    const_iterator begin() const noexcept { return bytes.data(); }
+    const_iterator end() const noexcept { return bytes.data() + N; }
+    byte& operator[](size_t index) noexcept { return bytes[index]; }
+    const byte& operator[](size_t index) const noexcept { return bytes[index]; }
+
+    /// Whether all bytes are zero, as in a default-initialized value.
+    bool isZero() const noexcept {
+        return std::all_of(bytes.begin(), bytes.end(), [](byte value) { return value == 0; });
+    }
+
+    bool operator==(const FixedData& rhs) const noexcept { return bytes == rhs.bytes; }
+    bool operator!=(const FixedData& rhs) const noexcept { return bytes != rhs.bytes; }
+    bool operator<(const FixedData& rhs) const noexcept { return bytes < rhs.bytes; }
+
+    friend bool operator==(const FixedData& lhs, const Data& rhs) noexcept {
+        return rhs.size() == N && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+    friend bool operator==(const Data& lhs, const FixedData& rhs) noexcept { return rhs == lhs; }
+    friend bool operator!=(const FixedData& lhs, const Data& rhs) noexcept { return !(lhs == rhs); }
+    friend bool operator!=(const Data& lhs, const FixedData& rhs) noexcept { return !(rhs == lhs); }
+
+private:
+    std::array<byte, N> bytes;
+};
+
+/// secp256k1 private key.
+using PrivateKey = FixedData<32>;
+
+/// Compressed secp256k1 public key.
+using PublicKey = FixedData<33>;
+
+/// RIPEMD-160 of the SHA-256 of a public key, the payload of an address.
+using KeyHash = FixedData<20>;
+
+/// Compact `r || s` ECDSA signature.
+using Signature64 = FixedData<64>;
+
+} // namespace
@@ -0,0 +1,286 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HDWallet.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/memzero.h"
+#include "crypto/pbkdf2.h"
+#include "crypto/sha2.h"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+using namespace Binance;
+
+/// Number of keys a thread derives per claim on the shared counter.
+static const size_t chunkSize = 64;
+
+/// Number of PBKDF2 rounds of a BIP39 seed.
+static const uint32_t mnemonicIterations = 2048;
+
+const uint32_t HDWallet::hardened;
+const uint32_t HDWallet::coinType;
+
+/// Copies the public half of a node.
+static ExtendedPublicKey extendedPublicKey(const HDNode& node) {
+    auto key = ExtendedPublicKey();
+    key.publicKey = PublicKey(node.public_key);
+    key.chainCode = FixedData<32>(node.chain_code);
+    return key;
+}
+
+/// Public-only node of an extended public key.
+static HDNode publicNode(const ExtendedPublicKey& key) {
+    auto node = HDNode();
+    std::copy(key.chainCode.begin(), key.chainCode.end(), node.chain_code);
+    std::copy(key.publicKey.begin(), key.publicKey.end(), node.public_key);
+    return node;
+}
+
+ExtendedPublicKey ExtendedPublicKey::child(uint32_t index) const {
+    if (index >= HDWallet::hardened) {
+        throw std::invalid_argument("Invalid index");
+    }
+    auto node = publicNode(*this);
+    if (!hdnode_public_ckd(&node, index)) {
+        throw std::runtime_error("Invalid derivation path");
+    }
+    return extendedPublicKey(node);
+}
+
+std::vector<PublicKey> ExtendedPublicKey::publicKeys(uint32_t start, size_t count) const {
+    if (start >= HDWallet::hardened || count > HDWallet::hardened - start) {
+        throw std::invalid_argument("Invalid index range");
+    }
+    static_assert(sizeof(PublicKey) == 33, "Keys are stored back to back");
+    auto keys = std::vector<PublicKey>(count);
+    if (count == 0) {
+        return keys;
+    }
+    const auto node = publicNode(*this);
+    auto results = std::vector<int>(count);
+    hdnode_public_ckd_batch(&node, start, count, keys.front().data(), results.data());
+    return keys;
+}
+
+std::vector<std::string> ExtendedPublicKey::addresses(uint32_t start, size_t count, const std::string& hrp) const {
+    const auto keys = publicKeys(start, count);
+    auto addresses = std::vector<std::string>();
+    addresses.reserve(count);
+    KeyHash keyHash;
+    for (const auto& key : keys) {
+        if (key.isZero()) {
+            addresses.emplace_back();
+            continue;
+        }
+        ecdsa_get_pubkeyhash(key.data(), HASHER_SHA2_RIPEMD, keyHash.data());
+        addresses.push_back(Address(hrp, keyHash).encode());
+    }
+    return addresses;
+}
+
+HDWallet::Seed HDWallet::mnemonicSeed(const std::string& mnemonic, const std::string& passphrase) {
+    auto salt = "mnemonic" + passphrase;
+    Seed seed;
+    pbkdf2_hmac_sha512(reinterpret_cast<const uint8_t*>(mnemonic.data()), static_cast<uint32_t>(mnemonic.size()),
+        reinterpret_cast<const uint8_t*>(salt.data()), static_cast<uint32_t>(salt.size()), mnemonicIterations,
+        seed.data(), static_cast<uint32_t>(seed.size()));
+    memzero(&salt[0], salt.size());
+    return seed;
+}
+
+std::vector<HDWallet::Seed> HDWallet::mnemonicSeeds(const std::vector<std::string>& mnemonics, const std::string& passphrase,
+    size_t threads) {
+    const auto count = mnemonics.size();
+    auto seeds = std::vector<Seed>(count);
+    if (count == 0) {
+        return seeds;
+    }
+    if (threads == 0) {
+        threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    threads = std::min(threads, (count + SHA512_LANES - 1) / SHA512_LANES);
+
+    auto salt = "mnemonic" + passphrase;
+    const auto saltData = reinterpret_cast<const uint8_t*>(salt.data());
+    const auto saltSize = static_cast<uint32_t>(salt.size());
+
+    std::atomic<size_t> next{0};
+    auto work = [&]() {
+        const uint8_t* pass[SHA512_LANES];
+        uint32_t passSizes[SHA512_LANES];
+        const uint8_t* salts[SHA512_LANES];
+        uint32_t saltSizes[SHA512_LANES];
+        uint8_t* keys[SHA512_LANES];
+        for (auto offset = next.fetch_add(SHA512_LANES); offset < count; offset = next.fetch_add(SHA512_LANES)) {
+            const auto size = std::min<size_t>(SHA512_LANES, count - offset);
+            for (size_t i = 0; i < size; i += 1) {
+                pass[i] = reinterpret_cast<const uint8_t*>(mnemonics[offset + i].data());
+                passSizes[i] = static_cast<uint32_t>(mnemonics[offset + i].size());
+                salts[i] = saltData;
+                saltSizes[i] = saltSize;
+                keys[i] = seeds[offset + i].data();
+            }
+            pbkdf2_hmac_sha512_batch(pass, passSizes, salts, saltSizes, mnemonicIterations, keys,
+                static_cast<uint32_t>(Seed::size()), size);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (size_t i = 1; i < threads; i += 1) {
+        pool.emplace_back(work);
+    }
+    work();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    memzero(&salt[0], salt.size());
+    return seeds;
+}
+
+HDWallet::HDWallet(ByteSpan seed) {
+    if (!hdnode_from_seed(seed.data(), seed.size(), &master)) {
+        throw std::invalid_argument("Invalid seed");
+    }
+}
+
+HDWallet::HDWallet(const std::string& mnemonic, const std::string& passphrase) {
+    auto seed = mnemonicSeed(mnemonic, passphrase);
+    const auto valid = hdnode_from_seed(seed.data(), seed.size(), &master);
+    memzero(seed.data(), seed.size());
+    if (!valid) {
+        throw std::invalid_argument("Invalid seed");
+    }
+}
+
+HDWallet::~HDWallet() {
+    memzero(&master, sizeof(master));
+    for (auto& entry : cache) {
+        memzero(&entry.second, sizeof(entry.second));
+    }
+}
+
+const HDNode& HDWallet::cachedNode(Span<const uint32_t> path) {
+    if (path.empty()) {
+        hdnode_fill_public_key(&master);
+        return master;
+    }
+
+    // Start from the deepest cached ancestor.
+    auto key = Path(path.begin(), path.end());
+    auto depth = path.size();
+    auto it = cache.find(key);
+    while (it == cache.end() && depth > 0) {
+        depth -= 1;
+        key.resize(depth);
+        it = depth == 0 ? cache.end() : cache.find(key);
+    }
+
+    auto node = depth == 0 ? master : it->second;
+    for (; depth < path.size(); depth += 1) {
+        if (!hdnode_private_ckd(&node, path[depth])) {
+            throw std::runtime_error("Invalid derivation path");
+        }
+        key.push_back(path[depth]);
+        it = cache.emplace(key, node).first;
+    }
+    memzero(&node, sizeof(node));
+
+    hdnode_fill_public_key(&it->second);
+    return it->second;
+}
+
+bool HDWallet::derive(Span<const uint32_t> path, HDNode& node) {
+    if (path.empty()) {
+        std::lock_guard<std::mutex> lock(mutex);
+        node = cachedNode(path);
+        return true;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        node = cachedNode(path.subspan(0, path.size() - 1));
+    }
+    return hdnode_private_ckd(&node, path[path.size() - 1]) != 0;
+}
+
+HDNode HDWallet::accountNode(uint32_t account) {
+    if (account >= hardened) {
+        throw std::invalid_argument("Invalid account");
+    }
+    const uint32_t path[] = {44 | hardened, coinType | hardened, account | hardened, 0};
+    std::lock_guard<std::mutex> lock(mutex);
+    return cachedNode(Span<const uint32_t>(path, 4));
+}
+
+PrivateKey HDWallet::privateKey(uint32_t index, uint32_t account) {
+    if (index >= hardened) {
+        throw std::invalid_argument("Invalid index");
+    }
+    auto node = accountNode(account);
+    PrivateKey key;
+    if (hdnode_private_ckd(&node, index)) {
+        key = PrivateKey(node.private_key);
+    }
+    memzero(&node, sizeof(node));
+    return key;
+}
+
+std::vector<PrivateKey> HDWallet::deriveRange(uint32_t start, size_t count, uint32_t account, size_t threads) {
+    if (start >= hardened || count > hardened - start) {
+        throw std::invalid_argument("Invalid index range");
+    }
+    auto parent = accountNode(account);
+    auto keys = std::vector<PrivateKey>(count);
+
+    if (threads == 0) {
+        threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    threads = std::max<size_t>(std::min(threads, (count + chunkSize - 1) / chunkSize), 1);
+
+    std::atomic<size_t> next{0};
+    auto work = [&]() {
+        HDNode node;
+        for (auto offset = next.fetch_add(chunkSize); offset < count; offset = next.fetch_add(chunkSize)) {
+            const auto end = std::min(offset + chunkSize, count);
+            for (auto i = offset; i < end; i += 1) {
+                node = parent;
+                if (hdnode_private_ckd(&node, start + static_cast<uint32_t>(i))) {
+                    keys[i] = PrivateKey(node.private_key);
+                }
+            }
+        }
+        memzero(&node, sizeof(node));
+    };
+
+    std::vector<std::thread> pool;
+    for (size_t i = 1; i < threads; i += 1) {
+        pool.emplace_back(work);
+    }
+    work();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    memzero(&parent, sizeof(parent));
+    return keys;
+}
+
+ExtendedPublicKey HDWallet::extendedPublicKey(uint32_t account) {
+    if (account >= hardened) {
+        throw std::invalid_argument("Invalid account");
+    }
+    const uint32_t path[] = {44 | hardened, coinType | hardened, account | hardened};
+    std::lock_guard<std::mutex> lock(mutex);
+    return ::extendedPublicKey(cachedNode(Span<const uint32_t>(path, 3)));
+}
+
+size_t HDWallet::cachedNodes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return cache.size();
+}
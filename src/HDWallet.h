@@ -0,0 +1,142 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include "Address.h"
+#include "Data.h"
+#include "FixedData.h"
+#include "Span.h"
+#include "crypto/bip32.h"
+
+#include <map>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace Binance {
+
+/// Public half of an extended key, as serialized in an xpub: enough to derive the public keys of its normal children
+/// without the private key.
+struct ExtendedPublicKey {
+    PublicKey publicKey;
+    FixedData<32> chainCode;
+
+    /// Derives a normal child.
+    ///
+    /// \throws std::invalid_argument if `index` is not below `HDWallet::hardened`.
+    /// \throws std::runtime_error for the indices BIP32 declares invalid.
+    ExtendedPublicKey child(uint32_t index) const;
+
+    /// Derives the public keys of the normal children `start` to `start + count - 1`.
+    ///
+    /// Each key takes a fixed-base multiplication and a point addition in Jacobian coordinates, and the keys are
+    /// converted to affine coordinates in chunks that share one field inversion.
+    ///
+    /// \throws std::invalid_argument if the range is not below `HDWallet::hardened`.
+    /// \returns the keys, all zeros for the indices BIP32 declares invalid.
+    std::vector<PublicKey> publicKeys(uint32_t start, size_t count) const;
+
+    /// Derives the addresses of the normal children `start` to `start + count - 1`.
+    ///
+    /// \throws std::invalid_argument if the range is not below `HDWallet::hardened`.
+    /// \returns the addresses, empty for the indices BIP32 declares invalid.
+    std::vector<std::string> addresses(uint32_t start, size_t count, const std::string& hrp = Address::binanceHRP) const;
+};
+
+/// BIP32 hierarchical deterministic wallet, deriving account keys along the Binance Chain BIP44 path
+/// m/44'/714'/account'/0/index.
+///
+/// Intermediate nodes are cached, so the key of each address index costs a single child derivation from its parent
+/// instead of a walk from the master node. Leaf keys are not cached. Thread-safe.
+class HDWallet {
+public:
+    /// Child indices at or above this value derive hardened children.
+    static const uint32_t hardened = BIP32_HARDENED;
+
+    /// BIP44 coin type of Binance Chain.
+    static const uint32_t coinType = 714;
+
+    /// BIP39 seed.
+    using Seed = FixedData<64>;
+
+    /// Computes the BIP39 seed of a mnemonic with PBKDF2-HMAC-SHA512.
+    ///
+    /// The mnemonic and passphrase are used as given: they must already be in Unicode NFKD form, and the mnemonic
+    /// words and checksum are not validated against a wordlist.
+    static Seed mnemonicSeed(const std::string& mnemonic, const std::string& passphrase = "");
+
+    /// Computes the BIP39 seeds of many mnemonics with the same passphrase, as when unlocking a keystore.
+    ///
+    /// Derivations run in groups of `SHA512_LANES` through the multi-lane SHA-512 transform, and the groups are split
+    /// over `threads` threads.
+    ///
+    /// \param threads number of threads, zero to use all cores.
+    static std::vector<Seed> mnemonicSeeds(const std::vector<std::string>& mnemonics, const std::string& passphrase = "",
+        size_t threads = 0);
+
+    /// Initializes a wallet with a 16 to 64 byte seed.
+    ///
+    /// \throws std::invalid_argument if the seed size is out of range or the seed derives an invalid master key.
+    explicit HDWallet(ByteSpan seed);
+
+    /// Initializes a wallet with the seed of a BIP39 mnemonic.
+    HDWallet(const std::string& mnemonic, const std::string& passphrase);
+
+    HDWallet(const HDWallet&) = delete;
+    HDWallet& operator=(const HDWallet&) = delete;
+
+    /// Wipes the master and cached nodes.
+    ~HDWallet();
+
+    /// Derives the node at a path of child indices below the master node, caching its ancestors.
+    ///
+    /// \throws std::runtime_error if an ancestor is one of the indices BIP32 declares invalid.
+    /// \returns `false`, with a wiped node, if the last index is invalid.
+    bool derive(Span<const uint32_t> path, HDNode& node);
+
+    /// Derives the private key of an address index at m/44'/714'/account'/0/index.
+    ///
+    /// \throws std::invalid_argument if `index` or `account` is not below `hardened`.
+    /// \returns the key, all zeros for the indices BIP32 declares invalid.
+    PrivateKey privateKey(uint32_t index, uint32_t account = 0);
+
+    /// Derives the private keys of `count` consecutive address indices starting at `start`, splitting them over
+    /// `threads` threads.
+    ///
+    /// The parent node is derived once and each key then costs one HMAC-SHA512 and a modular addition.
+    ///
+    /// \param threads number of threads, zero to use all cores.
+    /// \throws std::invalid_argument if the range or `account` is not below `hardened`.
+    std::vector<PrivateKey> deriveRange(uint32_t start, size_t count, uint32_t account = 0, size_t threads = 0);
+
+    /// Extended public key of an account at m/44'/714'/account', whose child 0 derives the address keys.
+    ///
+    /// \throws std::invalid_argument if `account` is not below `hardened`.
+    ExtendedPublicKey extendedPublicKey(uint32_t account = 0);
+
+    /// Number of cached intermediate nodes.
+    size_t cachedNodes() const;
+
+private:
+    using Path = std::vector<uint32_t>;
+
+    /// Returns the node at a path, deriving and caching it and the missing ancestors, with its public key computed.
+    /// Must be called with `mutex` held.
+    const HDNode& cachedNode(Span<const uint32_t> path);
+
+    /// Parent node of the address keys of an account, at m/44'/714'/account'/0.
+    HDNode accountNode(uint32_t account);
+
+    HDNode master;
+    mutable std::mutex mutex;
+    std::map<Path, HDNode> cache;
+};
+
+} // namespace
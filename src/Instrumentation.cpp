@@ -0,0 +1,232 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Instrumentation.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+
+using namespace Binance;
+using namespace Binance::Instrumentation;
+
+namespace {
+
+/// Histograms written by a single thread and read by snapshots.
+///
+/// The owning thread is the only writer, so updates are plain relaxed loads and stores rather than read-modify-write
+/// operations.
+struct ThreadHistograms {
+    struct Stage {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> sum{0};
+        std::atomic<uint64_t> min{0};
+        std::atomic<uint64_t> max{0};
+        std::atomic<uint64_t> buckets[Histogram::bucketCount];
+
+        Stage() {
+            for (auto& bucket : buckets) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    Stage stages[stageCount];
+};
+
+void add(std::atomic<uint64_t>& value, uint64_t amount) {
+    value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+void merge(Histogram& histogram, const ThreadHistograms::Stage& stage) {
+    const auto count = stage.count.load(std::memory_order_relaxed);
+    if (count == 0) {
+        return;
+    }
+    const auto min = stage.min.load(std::memory_order_relaxed);
+    const auto max = stage.max.load(std::memory_order_relaxed);
+    histogram.min = histogram.count == 0 ? min : std::min(histogram.min, min);
+    histogram.max = std::max(histogram.max, max);
+    histogram.count += count;
+    histogram.sum += stage.sum.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < Histogram::bucketCount; i += 1) {
+        histogram.buckets[i] += stage.buckets[i].load(std::memory_order_relaxed);
+    }
+}
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<ThreadHistograms*> threads;
+
+    /// Samples of threads that have exited.
+    Snapshot retired;
+};
+
+Registry& registry() {
+    // Never destroyed, threads may exit during static destruction.
+    static auto instance = new Registry();
+    return *instance;
+}
+
+/// Registers the calling thread's histograms on first use and retires them when the thread exits.
+class ThreadSlot {
+public:
+    ThreadHistograms& get() {
+        if (histograms == nullptr) {
+            histograms = new ThreadHistograms();
+            auto& registry = ::registry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.threads.push_back(histograms);
+        }
+        return *histograms;
+    }
+
+    ~ThreadSlot() {
+        if (histograms == nullptr) {
+            return;
+        }
+        auto& registry = ::registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (size_t i = 0; i < stageCount; i += 1) {
+            merge(registry.retired.stages[i], histograms->stages[i]);
+        }
+        registry.threads.erase(std::find(registry.threads.begin(), registry.threads.end(), histograms));
+        delete histograms;
+    }
+
+private:
+    ThreadHistograms* histograms = nullptr;
+};
+
+thread_local ThreadSlot slot;
+
+} // namespace
+
+const char* Instrumentation::stageName(Stage stage) {
+    switch (stage) {
+    case Stage::build: return "build";
+    case Stage::preimage: return "preimage";
+    case Stage::hash: return "hash";
+    case Stage::publicKey: return "publicKey";
+    case Stage::sign: return "sign";
+    case Stage::encode: return "encode";
+    case Stage::verify: return "verify";
+    }
+    return "";
+}
+
+const char* Instrumentation::unit() {
+#if defined(BINANCE_INSTRUMENTATION_RDTSC) && (defined(__x86_64__) || defined(__i386__))
+    return "cycles";
+#else
+    return "ns";
+#endif
+}
+
+const size_t Histogram::bucketCount;
+
+size_t Histogram::bucketIndex(uint64_t value) {
+    value = std::min<uint64_t>(value, (uint64_t(1) << 40) - 1);
+    if (value < 64) {
+        return static_cast<size_t>(value);
+    }
+    // Position of the leading one, then the five bits after it.
+    const auto exponent = 63 - __builtin_clzll(value);
+    const auto mantissa = (value >> (exponent - 5)) & 31;
+    return 64 + static_cast<size_t>(exponent - 6) * 32 + static_cast<size_t>(mantissa);
+}
+
+uint64_t Histogram::bucketValue(size_t index) {
+    if (index < 64) {
+        return index;
+    }
+    const auto exponent = (index - 64) / 32 + 6;
+    const auto mantissa = (index - 64) % 32;
+    return ((32 + mantissa + 1) << (exponent - 5)) - 1;
+}
+
+uint64_t Histogram::percentile(double percentile) const {
+    if (count == 0) {
+        return 0;
+    }
+    const auto target = std::max<uint64_t>(static_cast<uint64_t>(std::ceil(percentile / 100 * count)), 1);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < bucketCount; i += 1) {
+        seen += buckets[i];
+        if (seen >= target) {
+            return std::min(std::max(bucketValue(i), min), max);
+        }
+    }
+    return max;
+}
+
+void Instrumentation::record(Stage stage, uint64_t ticks) {
+    auto& histogram = slot.get().stages[static_cast<size_t>(stage)];
+    const auto count = histogram.count.load(std::memory_order_relaxed);
+    if (count == 0 || ticks < histogram.min.load(std::memory_order_relaxed)) {
+        histogram.min.store(ticks, std::memory_order_relaxed);
+    }
+    if (ticks > histogram.max.load(std::memory_order_relaxed)) {
+        histogram.max.store(ticks, std::memory_order_relaxed);
+    }
+    add(histogram.buckets[Histogram::bucketIndex(ticks)], 1);
+    add(histogram.sum, ticks);
+    histogram.count.store(count + 1, std::memory_order_relaxed);
+}
+
+Snapshot Instrumentation::snapshot() {
+    auto& registry = ::registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto snapshot = registry.retired;
+    for (auto histograms : registry.threads) {
+        for (size_t i = 0; i < stageCount; i += 1) {
+            merge(snapshot.stages[i], histograms->stages[i]);
+        }
+    }
+    return snapshot;
+}
+
+void Instrumentation::reset() {
+    auto& registry = ::registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.retired = Snapshot();
+    for (auto histograms : registry.threads) {
+        for (auto& stage : histograms->stages) {
+            stage.count.store(0, std::memory_order_relaxed);
+            stage.sum.store(0, std::memory_order_relaxed);
+            stage.min.store(0, std::memory_order_relaxed);
+            stage.max.store(0, std::memory_order_relaxed);
+            for (auto& bucket : stage.buckets) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+std::string Snapshot::json() const {
+    auto stages = nlohmann::json::object();
+    for (size_t i = 0; i < stageCount; i += 1) {
+        const auto& histogram = this->stages[i];
+        if (histogram.count == 0) {
+            continue;
+        }
+        stages[stageName(static_cast<Stage>(i))] = {
+            {"count", histogram.count},
+            {"mean", histogram.mean()},
+            {"min", histogram.min},
+            {"p50", histogram.percentile(50)},
+            {"p90", histogram.percentile(90)},
+            {"p99", histogram.percentile(99)},
+            {"p999", histogram.percentile(99.9)},
+            {"max", histogram.max},
+        };
+    }
+    return nlohmann::json{{"unit", unit()}, {"stages", stages}}.dump();
+}
@@ -0,0 +1,139 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include <array>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#if defined(BINANCE_INSTRUMENTATION_RDTSC) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
+
+namespace Binance {
+
+/// Per-stage latency histograms for the signing and verification hot paths.
+///
+/// Stages are timed with `BINANCE_INSTRUMENT`, which compiles to nothing unless `BINANCE_INSTRUMENTATION` is
+/// defined. Each thread records into its own histograms without locking; `snapshot()` merges them.
+namespace Instrumentation {
+
+enum class Stage {
+    /// `Signer::build` and `TransactionBuilder::build` from start to finish.
+    build,
+
+    /// JSON signature preimage generation, including the hash when the preimage is streamed into it.
+    preimage,
+
+    /// SHA-256 of a preimage generated as a string.
+    hash,
+
+    /// Public key derivation.
+    publicKey,
+
+    /// ECDSA signing.
+    sign,
+
+    /// Amino and protobuf encoding of the transaction.
+    encode,
+
+    /// ECDSA verification.
+    verify,
+};
+
+const size_t stageCount = 7;
+
+/// Name of a stage, as used in the JSON export.
+const char* stageName(Stage stage);
+
+/// Current time in ticks: nanoseconds, or TSC cycles with `BINANCE_INSTRUMENTATION_RDTSC` on x86.
+inline uint64_t now() {
+#if defined(BINANCE_INSTRUMENTATION_RDTSC) && (defined(__x86_64__) || defined(__i386__))
+    return __rdtsc();
+#else
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<uint64_t>(time.tv_sec) * 1000000000 + static_cast<uint64_t>(time.tv_nsec);
+#endif
+}
+
+/// Unit of the recorded values, "ns" or "cycles".
+const char* unit();
+
+/// Records a duration for a stage in the calling thread's histograms.
+void record(Stage stage, uint64_t ticks);
+
+/// Log-linear histogram with 32 sub-buckets per power of two, about 3% relative precision.
+struct Histogram {
+    /// Values up to 63 are exact, larger ones share buckets; values are clamped below 2^40.
+    static const size_t bucketCount = 64 + 34 * 32;
+
+    static size_t bucketIndex(uint64_t value);
+
+    /// Highest value that falls into a bucket.
+    static uint64_t bucketValue(size_t index);
+
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t min = 0;
+    uint64_t max = 0;
+    std::vector<uint64_t> buckets = std::vector<uint64_t>(bucketCount);
+
+    /// Value below which `percentile` percent of the recorded values fall, within the bucket precision.
+    uint64_t percentile(double percentile) const;
+
+    double mean() const { return count == 0 ? 0 : double(sum) / double(count); }
+};
+
+/// Histograms of all stages merged over all threads.
+struct Snapshot {
+    std::array<Histogram, stageCount> stages;
+
+    const Histogram& operator[](Stage stage) const { return stages[static_cast<size_t>(stage)]; }
+
+    /// Exports count, mean, min, max and percentiles of every stage with samples as JSON.
+    std::string json() const;
+};
+
+/// Merges the histograms of all live and exited threads.
+Snapshot snapshot();
+
+/// Clears all histograms; values recorded concurrently may be lost.
+void reset();
+
+/// Records the lifetime of the scope into a stage.
+class Scope {
+public:
+    explicit Scope(Stage stage) : stage(stage), start(now()) {}
+    ~Scope() { record(stage, now() - start); }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    const Stage stage;
+    const uint64_t start;
+};
+
+} // namespace Instrumentation
+} // namespace Binance
+
+#define BINANCE_INSTRUMENT_CONCAT_(a, b) a##b
+#define BINANCE_INSTRUMENT_CONCAT(a, b) BINANCE_INSTRUMENT_CONCAT_(a, b)
+
+/// Times the rest of the enclosing scope as `stage`, a `Binance::Instrumentation::Stage` member.
+#ifdef BINANCE_INSTRUMENTATION
+#define BINANCE_INSTRUMENT(stage) \
+    ::Binance::Instrumentation::Scope BINANCE_INSTRUMENT_CONCAT(instrumentationScope, __LINE__)(::Binance::Instrumentation::Stage::stage)
+#else
+#define BINANCE_INSTRUMENT(stage) do {} while (false)
+#endif
@@ -0,0 +1,231 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "KeyPairFile.h"
+
+#include "crypto/bignum.h"
+#include "crypto/memzero.h"
+#include "crypto/rand.h"
+#include "crypto/secp256k1.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace Binance;
+
+/// Number of points sharing a field inversion, and of records per write.
+static const size_t chunkSize = 256;
+
+/// Current file format version.
+static const uint32_t keyFileVersion = 1;
+
+const char KeyPairFile::magic[8] = {'B', 'N', 'B', 'K', 'E', 'Y', 'S', 0};
+const size_t KeyPairFile::headerSize;
+
+/// Adds a small number to a big-endian 256-bit key.
+static PrivateKey addToKey(PrivateKey key, uint64_t value) {
+    for (size_t i = key.size(); i-- > 0 && value != 0;) {
+        const auto sum = static_cast<uint64_t>(key[i]) + (value & 0xff);
+        key[i] = static_cast<byte>(sum);
+        value = (value >> 8) + (sum >> 8);
+    }
+    return key;
+}
+
+/// Whether `count` keys starting at `key` stay below the curve order.
+static bool fitsBelowOrder(const PrivateKey& key, uint64_t count) {
+    bignum256 last, offset;
+    bn_read_be(key.data(), &last);
+    bn_read_uint64(count, &offset);
+    bn_add(&last, &offset);
+    const auto fits = bn_is_less(&last, &secp256k1.order);
+    memzero(&last, sizeof(last));
+    return fits != 0;
+}
+
+KeyPairGenerator::KeyPairGenerator() {
+    bignum256 base;
+    do {
+        random_buffer(key.data(), key.size());
+        bn_read_be(key.data(), &base);
+    } while (bn_is_zero(&base) || !fitsBelowOrder(key, UINT64_MAX));
+    scalar_multiply_jacobian(&secp256k1, &base, &point);
+    memzero(&base, sizeof(base));
+}
+
+KeyPairGenerator::KeyPairGenerator(const PrivateKey& base) : key(base) {
+    bignum256 scalar;
+    bn_read_be(key.data(), &scalar);
+    const auto valid = !bn_is_zero(&scalar) && bn_is_less(&scalar, &secp256k1.order);
+    if (valid) {
+        scalar_multiply_jacobian(&secp256k1, &scalar, &point);
+    }
+    memzero(&scalar, sizeof(scalar));
+    if (!valid) {
+        throw std::invalid_argument("Invalid base key");
+    }
+}
+
+void KeyPairGenerator::generate(KeyRecord* records, size_t count) {
+    if (!fitsBelowOrder(key, count)) {
+        throw std::out_of_range("Key range reaches the curve order");
+    }
+    jacobian_curve_point points[chunkSize];
+    curve_point affine[chunkSize];
+    bignum256 scratch[2 * chunkSize];
+    uint8_t publicKey[33];
+    for (size_t offset = 0; offset < count; offset += chunkSize) {
+        const auto size = std::min(chunkSize, count - offset);
+        for (size_t i = 0; i < size; i += 1) {
+            points[i] = point;
+            point_jacobian_add(&secp256k1.G, &point, &secp256k1);
+        }
+        jacobian_to_curve_batch(points, affine, size, &secp256k1.prime, scratch);
+        for (size_t i = 0; i < size; i += 1) {
+            auto& record = records[offset + i];
+            publicKey[0] = 0x02 | (affine[i].y.val[0] & 0x01);
+            bn_write_be(&affine[i].x, publicKey + 1);
+            ecdsa_get_pubkeyhash(publicKey, HASHER_SHA2_RIPEMD, record.keyHash.data());
+            record.privateKey = key;
+            key = addToKey(key, 1);
+        }
+    }
+    memzero(points, sizeof(points));
+}
+
+static void writeLittleEndian(byte* out, uint64_t value, size_t size) {
+    for (size_t i = 0; i < size; i += 1) {
+        out[i] = static_cast<byte>(value >> (8 * i));
+    }
+}
+
+static uint64_t readLittleEndian(const byte* in, size_t size) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < size; i += 1) {
+        value |= static_cast<uint64_t>(in[i]) << (8 * i);
+    }
+    return value;
+}
+
+/// Writes all of a buffer at an offset.
+static void writeAt(int fd, const void* data, size_t size, uint64_t offset, const std::string& path) {
+    auto bytes = static_cast<const byte*>(data);
+    while (size > 0) {
+        const auto written = ::pwrite(fd, bytes, size, static_cast<off_t>(offset));
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::system_error(errno, std::generic_category(), path);
+        }
+        bytes += written;
+        size -= static_cast<size_t>(written);
+        offset += static_cast<uint64_t>(written);
+    }
+}
+
+void KeyPairFile::write(const std::string& path, uint64_t count, size_t threads) {
+    auto generator = KeyPairGenerator();
+    write(path, generator, count, threads);
+}
+
+void KeyPairFile::write(const std::string& path, KeyPairGenerator& generator, uint64_t count, size_t threads) {
+    const auto base = generator.next();
+    if (!fitsBelowOrder(base, count)) {
+        throw std::out_of_range("Key range reaches the curve order");
+    }
+    const auto fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), path);
+    }
+
+    // Little-endian header: magic, version, record size and record count.
+    byte header[headerSize];
+    std::memcpy(header, magic, sizeof(magic));
+    writeLittleEndian(header + 8, keyFileVersion, 4);
+    writeLittleEndian(header + 12, sizeof(KeyRecord), 4);
+    writeLittleEndian(header + 16, count, 8);
+
+    if (threads == 0) {
+        threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    threads = static_cast<size_t>(std::max<uint64_t>(std::min<uint64_t>(threads, (count + chunkSize - 1) / chunkSize), 1));
+
+    // Each thread walks its own share from the base key, after one full multiplication to get there.
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    auto work = [&](size_t thread) {
+        try {
+            const auto first = count * thread / threads;
+            const auto last = count * (thread + 1) / threads;
+            auto local = thread == 0 ? KeyPairGenerator(generator) : KeyPairGenerator(addToKey(base, first));
+            KeyRecord records[chunkSize];
+            for (auto offset = first; offset < last && !failed; offset += chunkSize) {
+                const auto size = static_cast<size_t>(std::min<uint64_t>(chunkSize, last - offset));
+                local.generate(records, size);
+                writeAt(fd, records, size * sizeof(KeyRecord), headerSize + offset * sizeof(KeyRecord), path);
+            }
+            memzero(records, sizeof(records));
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+            failed = true;
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (size_t i = 1; i < threads; i += 1) {
+        pool.emplace_back(work, i);
+    }
+    work(0);
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    try {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        // The header goes last, so an interrupted write leaves no valid file.
+        writeAt(fd, header, sizeof(header), 0, path);
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+    if (::close(fd) != 0) {
+        throw std::system_error(errno, std::generic_category(), path);
+    }
+    generator = KeyPairGenerator(addToKey(base, count));
+}
+
+KeyPairFile::KeyPairFile(const std::string& path) : file(path) {
+    const auto data = file.data();
+    if (data.size() < headerSize || std::memcmp(data.data(), magic, sizeof(magic)) != 0) {
+        throw std::runtime_error("Invalid key file: " + path);
+    }
+    const auto size = readLittleEndian(data.data() + 16, 8);
+    if (readLittleEndian(data.data() + 8, 4) != keyFileVersion || readLittleEndian(data.data() + 12, 4) != sizeof(KeyRecord) ||
+        size > (data.size() - headerSize) / sizeof(KeyRecord)) {
+        throw std::runtime_error("Invalid key file: " + path);
+    }
+    records = reinterpret_cast<const KeyRecord*>(data.data() + headerSize);
+    count = static_cast<size_t>(size);
+}
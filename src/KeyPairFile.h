@@ -0,0 +1,104 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include "Address.h"
+#include "FixedData.h"
+#include "TransactionFile.h"
+#include "crypto/ecdsa.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace Binance {
+
+/// Generated key pair: a private key and the key hash of its address.
+struct KeyRecord {
+    PrivateKey privateKey;
+    KeyHash keyHash;
+};
+
+static_assert(sizeof(KeyRecord) == 52 && alignof(KeyRecord) == 1, "Records are packed bytes");
+
+/// Generates throwaway key pairs for load tests by walking consecutive private keys k, k + 1, k + 2...
+///
+/// Each public key is the previous one plus G, a Jacobian point addition, and the points are converted to affine
+/// coordinates in chunks that share one field inversion. The keys are trivially related to each other, never use
+/// them for funds.
+class KeyPairGenerator {
+public:
+    /// Initializes a generator at a random base key, which leaves room for at least 2^64 keys.
+    KeyPairGenerator();
+
+    /// Initializes a generator at a base key.
+    ///
+    /// \throws std::invalid_argument if the key is zero or not below the curve order.
+    explicit KeyPairGenerator(const PrivateKey& base);
+
+    /// Private key of the next record.
+    const PrivateKey& next() const { return key; }
+
+    /// Generates the next `count` key pairs.
+    ///
+    /// \throws std::out_of_range if the keys would reach the curve order.
+    void generate(KeyRecord* records, size_t count);
+
+private:
+    PrivateKey key;
+
+    /// `key` times G.
+    jacobian_curve_point point;
+};
+
+/// Memory-mapped file of key pairs, a fixed header followed by packed `KeyRecord`s.
+class KeyPairFile {
+public:
+    /// Magic bytes at the start of a key file.
+    static const char magic[8];
+
+    /// Header size, records start at this offset.
+    static const size_t headerSize = 24;
+
+    /// Generates `count` key pairs from a random base key and writes them to a file, splitting the range over
+    /// `threads` threads.
+    ///
+    /// \param threads number of threads, zero to use all cores.
+    /// \throws std::system_error if the file cannot be written.
+    static void write(const std::string& path, uint64_t count, size_t threads = 0);
+
+    /// Generates key pairs from a generator and writes them to a file.
+    ///
+    /// \throws std::system_error if the file cannot be written.
+    static void write(const std::string& path, KeyPairGenerator& generator, uint64_t count, size_t threads = 0);
+
+    /// Maps a key file.
+    ///
+    /// \throws std::system_error if the file cannot be opened or mapped.
+    /// \throws std::runtime_error if the header is invalid or the file is truncated.
+    explicit KeyPairFile(const std::string& path);
+
+    /// Number of records.
+    size_t size() const { return count; }
+
+    const KeyRecord& operator[](size_t index) const { return records[index]; }
+    const KeyRecord* begin() const { return records; }
+    const KeyRecord* end() const { return records + count; }
+
+    /// Address of a record.
+    Address address(size_t index, const std::string& hrp = Address::binanceHRP) const {
+        return Address(hrp, records[index].keyHash);
+    }
+
+private:
+    MappedFile file;
+    const KeyRecord* records = nullptr;
+    size_t count = 0;
+};
+
+} // namespace
@@ -0,0 +1,326 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include "Amino.h"
+#include "Data.h"
+#include "Decoder.h"
+#include "Span.h"
+
+#include <algorithm>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace Binance {
+
+/// Plain structs for the messages in `dex.proto`, encoded and decoded inline without the protobuf runtime.
+///
+/// Fields are written in field number order and proto3 default values are skipped, so the encoding is byte for byte
+/// the one of the generated classes. Keep the field numbers in sync with `dex.proto`.
+namespace Messages {
+
+/// Returns the bytes of a string field.
+inline ByteSpan bytesOf(const std::string& string) {
+    return ByteSpan(reinterpret_cast<const byte*>(string.data()), string.size());
+}
+
+/// Returns a string field from a decoded view.
+inline std::string stringOf(StringSpan string) {
+    return std::string(string.data(), string.size());
+}
+
+/// Returns a bytes field from a decoded view.
+inline Data dataOf(ByteSpan bytes) {
+    return Data(bytes.begin(), bytes.end());
+}
+
+/// `Send.Token`, a coin amount.
+struct Token {
+    static constexpr uint32_t denomField = 1;
+    static constexpr uint32_t amountField = 2;
+
+    std::string denom;
+    int64_t amount = 0;
+
+    size_t encodedSize() const {
+        return Amino::bytesFieldSize(denom.size()) + Amino::intFieldSize(amount);
+    }
+
+    byte* encode(byte* out) const {
+        out = Amino::writeBytesField(out, denomField, bytesOf(denom));
+        return Amino::writeIntField(out, amountField, amount);
+    }
+
+    static Token from(const Amino::TokenView& view) {
+        return Token{stringOf(view.denom), view.amount};
+    }
+};
+
+/// `Send.Input` or `Send.Output`, coins leaving or entering an address.
+struct SendEntry {
+    static constexpr uint32_t addressField = 1;
+    static constexpr uint32_t coinsField = 2;
+
+    Data address;
+    std::vector<Token> coins;
+
+    size_t encodedSize() const {
+        auto size = Amino::bytesFieldSize(address.size());
+        for (auto& coin : coins) {
+            size += Amino::fieldSize(coin.encodedSize());
+        }
+        return size;
+    }
+
+    byte* encode(byte* out) const {
+        out = Amino::writeBytesField(out, addressField, address);
+        for (auto& coin : coins) {
+            *out++ = static_cast<byte>(coinsField << 3 | 2);
+            out = Amino::writeVarint(out, coin.encodedSize());
+            out = coin.encode(out);
+        }
+        return out;
+    }
+
+    static SendEntry from(const Amino::SendEntryView& view) {
+        auto entry = SendEntry{dataOf(view.address), {}};
+        entry.coins.reserve(view.coins.size());
+        for (auto& coin : view.coins) {
+            entry.coins.push_back(Token::from(coin));
+        }
+        return entry;
+    }
+};
+
+/// `Send` order, transfers between addresses.
+struct Send {
+    using Token = Messages::Token;
+    using Input = SendEntry;
+    using Output = SendEntry;
+
+    static constexpr uint32_t inputsField = 1;
+    static constexpr uint32_t outputsField = 2;
+    static constexpr Amino::MessageView::Type type = Amino::MessageView::Type::send;
+    static const Data& prefix() { return Amino::sendOrderPrefix; }
+
+    std::vector<Input> inputs;
+    std::vector<Output> outputs;
+
+    size_t encodedSize() const {
+        size_t size = 0;
+        for (auto& input : inputs) {
+            size += Amino::fieldSize(input.encodedSize());
+        }
+        for (auto& output : outputs) {
+            size += Amino::fieldSize(output.encodedSize());
+        }
+        return size;
+    }
+
+    byte* encode(byte* out) const {
+        for (auto& input : inputs) {
+            *out++ = static_cast<byte>(inputsField << 3 | 2);
+            out = Amino::writeVarint(out, input.encodedSize());
+            out = input.encode(out);
+        }
+        for (auto& output : outputs) {
+            *out++ = static_cast<byte>(outputsField << 3 | 2);
+            out = Amino::writeVarint(out, output.encodedSize());
+            out = output.encode(out);
+        }
+        return out;
+    }
+
+    static bool decode(ByteSpan data, Send& order) {
+        Amino::SendView view;
+        if (!Amino::SendView::decode(data, view)) {
+            return false;
+        }
+        order = Send();
+        order.inputs.reserve(view.inputs.size());
+        for (auto& input : view.inputs) {
+            order.inputs.push_back(SendEntry::from(input));
+        }
+        order.outputs.reserve(view.outputs.size());
+        for (auto& output : view.outputs) {
+            order.outputs.push_back(SendEntry::from(output));
+        }
+        return true;
+    }
+};
+
+/// `NewOrder` order, places a limit order.
+struct NewOrder {
+    static constexpr uint32_t senderField = 1;
+    static constexpr uint32_t idField = 2;
+    static constexpr uint32_t symbolField = 3;
+    static constexpr uint32_t ordertypeField = 4;
+    static constexpr uint32_t sideField = 5;
+    static constexpr uint32_t priceField = 6;
+    static constexpr uint32_t quantityField = 7;
+    static constexpr uint32_t timeinforceField = 8;
+    static constexpr Amino::MessageView::Type type = Amino::MessageView::Type::newOrder;
+    static const Data& prefix() { return Amino::tradeOrderPrefix; }
+
+    Data sender;
+    std::string id;
+    std::string symbol;
+    int64_t ordertype = 0;
+    int64_t side = 0;
+    int64_t price = 0;
+    int64_t quantity = 0;
+    int64_t timeinforce = 0;
+
+    size_t encodedSize() const {
+        return Amino::bytesFieldSize(sender.size()) + Amino::bytesFieldSize(id.size()) +
+            Amino::bytesFieldSize(symbol.size()) + Amino::intFieldSize(ordertype) + Amino::intFieldSize(side) +
+            Amino::intFieldSize(price) + Amino::intFieldSize(quantity) + Amino::intFieldSize(timeinforce);
+    }
+
+    byte* encode(byte* out) const {
+        out = Amino::writeBytesField(out, senderField, sender);
+        out = Amino::writeBytesField(out, idField, bytesOf(id));
+        out = Amino::writeBytesField(out, symbolField, bytesOf(symbol));
+        out = Amino::writeIntField(out, ordertypeField, ordertype);
+        out = Amino::writeIntField(out, sideField, side);
+        out = Amino::writeIntField(out, priceField, price);
+        out = Amino::writeIntField(out, quantityField, quantity);
+        return Amino::writeIntField(out, timeinforceField, timeinforce);
+    }
+
+    static bool decode(ByteSpan data, NewOrder& order) {
+        Amino::NewOrderView view;
+        if (!Amino::NewOrderView::decode(data, view)) {
+            return false;
+        }
+        order = NewOrder{dataOf(view.sender), stringOf(view.id), stringOf(view.symbol), view.ordertype, view.side,
+            view.price, view.quantity, view.timeinforce};
+        return true;
+    }
+};
+
+/// `CancelOrder` order, cancels an open order.
+struct CancelOrder {
+    static constexpr uint32_t senderField = 1;
+    static constexpr uint32_t symbolField = 2;
+    static constexpr uint32_t refidField = 3;
+    static constexpr Amino::MessageView::Type type = Amino::MessageView::Type::cancelOrder;
+    static const Data& prefix() { return Amino::cancelTradeOrderPrefix; }
+
+    Data sender;
+    std::string symbol;
+    std::string refid;
+
+    size_t encodedSize() const {
+        return Amino::bytesFieldSize(sender.size()) + Amino::bytesFieldSize(symbol.size()) +
+            Amino::bytesFieldSize(refid.size());
+    }
+
+    byte* encode(byte* out) const {
+        out = Amino::writeBytesField(out, senderField, sender);
+        out = Amino::writeBytesField(out, symbolField, bytesOf(symbol));
+        return Amino::writeBytesField(out, refidField, bytesOf(refid));
+    }
+
+    static bool decode(ByteSpan data, CancelOrder& order) {
+        Amino::CancelOrderView view;
+        if (!Amino::CancelOrderView::decode(data, view)) {
+            return false;
+        }
+        order = CancelOrder{dataOf(view.sender), stringOf(view.symbol), stringOf(view.refid)};
+        return true;
+    }
+};
+
+/// Fields shared by `TokenFreeze` and `TokenUnfreeze`.
+struct TokenAmount {
+    static constexpr uint32_t fromField = 1;
+    static constexpr uint32_t symbolField = 2;
+    static constexpr uint32_t amountField = 3;
+
+    Data from;
+    std::string symbol;
+    int64_t amount = 0;
+
+    size_t encodedSize() const {
+        return Amino::bytesFieldSize(from.size()) + Amino::bytesFieldSize(symbol.size()) +
+            Amino::intFieldSize(amount);
+    }
+
+    byte* encode(byte* out) const {
+        out = Amino::writeBytesField(out, fromField, from);
+        out = Amino::writeBytesField(out, symbolField, bytesOf(symbol));
+        return Amino::writeIntField(out, amountField, amount);
+    }
+
+protected:
+    bool decodeFields(ByteSpan data) {
+        Amino::TokenFreezeView view;
+        if (!Amino::TokenFreezeView::decode(data, view)) {
+            return false;
+        }
+        from = dataOf(view.from);
+        symbol = stringOf(view.symbol);
+        amount = view.amount;
+        return true;
+    }
+};
+
+/// `TokenFreeze` order, freezes an amount of a token.
+struct TokenFreeze : TokenAmount {
+    static constexpr Amino::MessageView::Type type = Amino::MessageView::Type::tokenFreeze;
+    static const Data& prefix() { return Amino::tokenFreezeOrderPrefix; }
+
+    static bool decode(ByteSpan data, TokenFreeze& order) { return order.decodeFields(data); }
+};
+
+/// `TokenUnfreeze` order, unfreezes an amount of a token.
+struct TokenUnfreeze : TokenAmount {
+    static constexpr Amino::MessageView::Type type = Amino::MessageView::Type::tokenUnfreeze;
+    static const Data& prefix() { return Amino::tokenUnfreezeOrderPrefix; }
+
+    static bool decode(ByteSpan data, TokenUnfreeze& order) { return order.decodeFields(data); }
+};
+
+/// Returns the size of an order with its Amino type prefix.
+template <typename Order>
+size_t orderEncodedSize(const Order& order) {
+    return Order::prefix().size() + order.encodedSize();
+}
+
+/// Writes an order with its Amino type prefix, `orderEncodedSize` bytes, returning the position after it.
+template <typename Order>
+byte* writeOrder(byte* out, const Order& order) {
+    out = std::copy(Order::prefix().begin(), Order::prefix().end(), out);
+    return order.encode(out);
+}
+
+/// Encodes an order with its Amino type prefix, the same bytes as `Amino::encodeOrder` of the generated message.
+///
+/// The result is what `Signer` takes as an encoded order.
+template <typename Order>
+Data encodeOrder(const Order& order) {
+    auto encoded = Data(orderEncodedSize(order));
+    writeOrder(encoded.data(), order);
+    return encoded;
+}
+
+/// Decodes an order with its Amino type prefix.
+///
+/// \returns `false` if the prefix is not the one of `Order` or the fields are malformed.
+template <typename Order>
+bool decodeOrder(ByteSpan data, Order& order) {
+    const auto& prefix = Order::prefix();
+    if (data.size() < prefix.size() || !std::equal(prefix.begin(), prefix.end(), data.begin())) {
+        return false;
+    }
+    return Order::decode(data.subspan(prefix.size()), order);
+}
+
+}} // namespace
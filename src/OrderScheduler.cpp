@@ -0,0 +1,231 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "OrderScheduler.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+using namespace Binance;
+
+constexpr std::chrono::microseconds OrderScheduler::defaultWindow;
+
+/// Returns the index of the power-of-two bucket holding a value.
+static inline size_t bucket(uint64_t value, size_t count) {
+    size_t index = 0;
+    while (value != 0 && index + 1 < count) {
+        value >>= 1;
+        index += 1;
+    }
+    return index;
+}
+
+OrderScheduler::OrderScheduler(AccountRegistry& accounts, const std::string& chainId, std::chrono::microseconds window, std::chrono::microseconds cancelWindow, size_t maxMessages)
+    : chainId(chainId), window(window), cancelWindow(cancelWindow), maxMessages(maxMessages), accounts(accounts) {
+    thread = std::thread(&OrderScheduler::run, this);
+}
+
+OrderScheduler::~OrderScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    condition.notify_one();
+    thread.join();
+}
+
+void OrderScheduler::addAccount(const std::string& name, const Data& privateKey, int64_t accountNumber, int64_t sequence) {
+    accounts.add(name, privateKey, accountNumber, sequence);
+}
+
+int64_t OrderScheduler::sequence(const std::string& name) const {
+    auto account = accounts.find(name);
+    if (account == nullptr) {
+        throw std::invalid_argument("Unknown account");
+    }
+    return account->sequence();
+}
+
+std::future<Data> OrderScheduler::submit(const std::string& name, const NewOrder& order) {
+    return enqueue(name, std::unique_ptr<::google::protobuf::Message>(new NewOrder(order)), false);
+}
+
+std::future<Data> OrderScheduler::submit(const std::string& name, const CancelOrder& order) {
+    return enqueue(name, std::unique_ptr<::google::protobuf::Message>(new CancelOrder(order)), true);
+}
+
+std::future<Data> OrderScheduler::enqueue(const std::string& name, std::unique_ptr<::google::protobuf::Message> order, bool cancel) {
+    auto pending = Pending();
+    pending.account = accounts.find(name);
+    if (pending.account == nullptr) {
+        throw std::invalid_argument("Unknown account");
+    }
+    pending.order = std::move(order);
+    pending.time = Clock::now();
+    auto future = pending.promise.get_future();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& lane = cancel ? cancels : orders;
+        lane.push_back(std::move(pending));
+    }
+    condition.notify_one();
+    return future;
+}
+
+void OrderScheduler::flush() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        flushRequested = true;
+    }
+    condition.notify_one();
+}
+
+OrderScheduler::Metrics OrderScheduler::metrics() const {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    return stats;
+}
+
+void OrderScheduler::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        if (cancels.empty() && orders.empty()) {
+            flushRequested = false;
+            if (stopping) {
+                return;
+            }
+            condition.wait(lock);
+            continue;
+        }
+
+        auto deadline = Clock::time_point::max();
+        if (!orders.empty()) {
+            deadline = orders.front().time + window;
+        }
+        if (!cancels.empty()) {
+            deadline = std::min(deadline, cancels.front().time + cancelWindow);
+        }
+        const auto full = cancels.size() + orders.size() >= maxMessages;
+        if (!full && !flushRequested && !stopping && Clock::now() < deadline) {
+            condition.wait_until(lock, deadline);
+            continue;
+        }
+
+        std::deque<Pending> cancelBatch;
+        std::deque<Pending> orderBatch;
+        cancelBatch.swap(cancels);
+        orderBatch.swap(orders);
+        flushRequested = false;
+
+        lock.unlock();
+        sign(cancelBatch, orderBatch);
+        lock.lock();
+    }
+}
+
+void OrderScheduler::sign(std::deque<Pending>& cancelBatch, std::deque<Pending>& orderBatch) {
+    const auto now = Clock::now();
+
+    // Group by account, cancels ahead of new orders.
+    std::vector<std::pair<Account*, std::vector<Pending*>>> groups;
+    std::unordered_map<Account*, size_t> index;
+    std::array<uint64_t, 32> queueDelay{};
+    for (auto lane : { &cancelBatch, &orderBatch }) {
+        for (auto& pending : *lane) {
+            auto it = index.find(pending.account.get());
+            if (it == index.end()) {
+                it = index.emplace(pending.account.get(), groups.size()).first;
+                groups.emplace_back(pending.account.get(), std::vector<Pending*>());
+            }
+            groups[it->second].second.push_back(&pending);
+
+            const auto delay = std::chrono::duration_cast<std::chrono::microseconds>(now - pending.time).count();
+            queueDelay[bucket(static_cast<uint64_t>(std::max<int64_t>(delay, 0)), queueDelay.size())] += 1;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        for (size_t i = 0; i < stats.queueDelay.size(); i += 1) {
+            stats.queueDelay[i] += queueDelay[i];
+        }
+    }
+
+    for (auto& group : groups) {
+        auto account = group.first;
+        auto builder = TransactionBuilder();
+        builder.chainId = chainId;
+        builder.accountNumber = account->accountNumber;
+        builder.privateKey = account->privateKey;
+        builder.maxMessages = maxMessages;
+
+        // A batch reserves its sequence number when it is opened, so sizing and signing use the same number.
+        std::vector<Pending*> members;
+        auto reserved = false;
+        auto reserve = [&]() {
+            if (!reserved) {
+                builder.sequence = account->nextSequence();
+                reserved = true;
+            }
+        };
+        auto release = [&]() {
+            // A skipped number makes the chain reject the account's later transactions.
+            if (reserved && !account->rollback(builder.sequence)) {
+                account->markForResync();
+            }
+            reserved = false;
+        };
+        auto emit = [&]() {
+            const auto transaction = builder.build();
+            if (transaction.empty()) {
+                release();
+            } else {
+                reserved = false;
+            }
+            {
+                // Record before fulfilling so callers observe the statistics of their own transaction.
+                std::lock_guard<std::mutex> lock(statsMutex);
+                if (transaction.empty()) {
+                    stats.failed += members.size();
+                } else {
+                    stats.orders += members.size();
+                    stats.transactions += 1;
+                    stats.batchSize[bucket(members.size(), stats.batchSize.size())] += 1;
+                }
+            }
+            for (auto member : members) {
+                member->promise.set_value(transaction);
+            }
+            builder.clear();
+            members.clear();
+        };
+
+        for (auto pending : group.second) {
+            reserve();
+            if (!builder.add(*pending->order)) {
+                if (!builder.empty()) {
+                    emit();
+                    reserve();
+                }
+                if (!builder.add(*pending->order)) {
+                    // Does not fit in a transaction on its own.
+                    {
+                        std::lock_guard<std::mutex> lock(statsMutex);
+                        stats.failed += 1;
+                    }
+                    pending->promise.set_value({});
+                    continue;
+                }
+            }
+            members.push_back(pending);
+        }
+        if (!builder.empty()) {
+            emit();
+        }
+        release();
+    }
+}
@@ -0,0 +1,141 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include "dex.pb.h"
+#include "AccountRegistry.h"
+#include "Data.h"
+#include "TransactionBuilder.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <thread>
+
+namespace Binance {
+
+/// Coalesces orders submitted from many threads into multi-message transactions.
+///
+/// Orders are queued for up to `window` and then signed as one transaction per account. Cancels go through a
+/// separate lane with its own, normally zero, window: a pending cancel flushes the queue and is placed ahead of the
+/// account's new orders. Each emitted transaction reserves the account's next sequence number from the registry, so
+/// other signers can share the same accounts.
+class OrderScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Default time new orders wait for other orders.
+    static constexpr std::chrono::microseconds defaultWindow = std::chrono::microseconds(500);
+
+    /// Scheduler statistics.
+    struct Metrics {
+        /// Number of orders signed.
+        uint64_t orders = 0;
+
+        /// Number of transactions emitted.
+        uint64_t transactions = 0;
+
+        /// Number of orders that were not signed, because they don't fit in a transaction or signing failed.
+        uint64_t failed = 0;
+
+        /// Queueing delay histogram, bucket `i` counts delays in [2^(i-1), 2^i) microseconds.
+        std::array<uint64_t, 32> queueDelay{};
+
+        /// Batch size histogram, bucket `i` counts transactions with [2^(i-1), 2^i) messages.
+        std::array<uint64_t, 16> batchSize{};
+
+        /// Number of signatures avoided by batching.
+        uint64_t signaturesSaved() const { return orders - transactions; }
+    };
+
+    /// Chain identifier.
+    const std::string chainId;
+
+    /// Maximum time a new order waits before its batch is signed.
+    const std::chrono::microseconds window;
+
+    /// Maximum time a cancel waits before its batch is signed.
+    const std::chrono::microseconds cancelWindow;
+
+    /// Maximum number of messages per transaction, a full batch is signed immediately.
+    const size_t maxMessages;
+
+    /// Accounts orders can be submitted for.
+    AccountRegistry& accounts;
+
+    /// Initializes a scheduler and starts its signing thread.
+    OrderScheduler(AccountRegistry& accounts, const std::string& chainId = "chain-bnb", std::chrono::microseconds window = defaultWindow,
+        std::chrono::microseconds cancelWindow = std::chrono::microseconds(0), size_t maxMessages = TransactionBuilder::defaultMaxMessages);
+
+    /// Signs all pending orders and stops the signing thread.
+    ~OrderScheduler();
+
+    OrderScheduler(const OrderScheduler&) = delete;
+    OrderScheduler& operator=(const OrderScheduler&) = delete;
+
+    /// Registers an account in the registry that orders can be submitted for.
+    ///
+    /// \throws std::invalid_argument if `privateKey` is not a 32-byte key.
+    void addAccount(const std::string& name, const Data& privateKey, int64_t accountNumber, int64_t sequence);
+
+    /// Sequence number the account's next transaction will use.
+    ///
+    /// \throws std::invalid_argument if the account is not registered.
+    int64_t sequence(const std::string& name) const;
+
+    /// Queues a new order.
+    ///
+    /// \returns a future for the signed transaction containing the order, empty if signing failed.
+    /// \throws std::invalid_argument if the account is not registered.
+    std::future<Data> submit(const std::string& name, const NewOrder& order);
+
+    /// Queues a cancel in the priority lane.
+    ///
+    /// \returns a future for the signed transaction containing the cancel, empty if signing failed.
+    /// \throws std::invalid_argument if the account is not registered.
+    std::future<Data> submit(const std::string& name, const CancelOrder& order);
+
+    /// Signs all pending orders without waiting for their windows to expire.
+    void flush();
+
+    /// Returns a snapshot of the scheduler statistics.
+    Metrics metrics() const;
+
+private:
+    struct Pending {
+        std::shared_ptr<Account> account;
+        std::unique_ptr<::google::protobuf::Message> order;
+        std::promise<Data> promise;
+        Clock::time_point time;
+    };
+
+    std::future<Data> enqueue(const std::string& name, std::unique_ptr<::google::protobuf::Message> order, bool cancel);
+    void run();
+    void sign(std::deque<Pending>& cancelBatch, std::deque<Pending>& orderBatch);
+
+    std::deque<Pending> cancels;
+    std::deque<Pending> orders;
+    bool flushRequested = false;
+    bool stopping = false;
+    mutable std::mutex mutex;
+    std::condition_variable condition;
+
+    Metrics stats;
+    mutable std::mutex statsMutex;
+
+    std::thread thread;
+};
+
+} // namespace
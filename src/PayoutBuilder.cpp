@@ -0,0 +1,200 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "PayoutBuilder.h"
+#include "Amino.h"
+#include "Signer.h"
+#include "TransactionBuilder.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/secp256k1.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+using namespace Binance;
+
+static inline size_t tokenSize(const std::string& denom, int64_t amount) {
+    return Amino::fieldSize(denom.size()) + 1 + Amino::varintSize(static_cast<uint64_t>(amount));
+}
+
+static inline size_t coinsSize(const std::map<std::string, int64_t>& coins) {
+    size_t size = 0;
+    for (auto& coin : coins) {
+        size += Amino::fieldSize(tokenSize(coin.first, coin.second));
+    }
+    return size;
+}
+
+PayoutBuilder::PayoutBuilder() : chainId("chain-bnb"), accountNumber(), sequence(), source(), memo(), privateKey(), maxOutputs(defaultMaxOutputs), maxSize(TransactionBuilder::defaultMaxSize), threads() {}
+
+bool PayoutBuilder::add(const Data& address, const std::string& denom, int64_t amount) {
+    if (amount <= 0 || denom.empty()) {
+        return false;
+    }
+
+    const auto key = std::string(address.begin(), address.end());
+    auto it = index.find(key);
+    if (it == index.end()) {
+        it = index.emplace(key, outputs.size()).first;
+        outputs.push_back(Output{ address, {} });
+    }
+
+    auto& total = outputs[it->second].coins[denom];
+    if (amount > std::numeric_limits<int64_t>::max() - total) {
+        return false;
+    }
+    total += amount;
+    return true;
+}
+
+namespace {
+
+/// Running totals for the batch being packed.
+struct Batch {
+    size_t begin = 0;
+    size_t count = 0;
+    std::map<std::string, int64_t> totals;
+    size_t inputCoinsSize = 0;
+    size_t outputsSize = 0;
+};
+
+} // namespace
+
+std::vector<Send> PayoutBuilder::pack() const {
+    if (privateKey.size() != 32) {
+        throw std::invalid_argument("Invalid private key");
+    }
+
+    byte publicKey[Amino::publicKeySize];
+    ecdsa_get_public_key33(&secp256k1, privateKey.data(), publicKey);
+    Data sender(20);
+    ecdsa_get_pubkeyhash(publicKey, HASHER_SHA2_RIPEMD, sender.data());
+
+    std::vector<Batch> batches;
+    auto batch = Batch();
+
+    auto transactionSize = [&](size_t inputCoinsSize, size_t outputsSize, size_t batchIndex) {
+        const auto inputSize = Amino::fieldSize(Amino::fieldSize(sender.size()) + inputCoinsSize);
+        const auto messageSize = Amino::sendOrderPrefix.size() + inputSize + outputsSize;
+        const auto signatureSize = Amino::signatureEncodedSize(accountNumber, sequence + static_cast<int64_t>(batchIndex));
+        return Amino::transactionEncodedSize(Amino::fieldSize(messageSize), signatureSize, memo, source);
+    };
+
+    // Sizes the batch's aggregated input as if the output were added to it.
+    auto inputCoinsSizeWith = [](const Batch& batch, const Output& output, bool& overflow) {
+        auto size = batch.inputCoinsSize;
+        overflow = false;
+        for (auto& coin : output.coins) {
+            auto it = batch.totals.find(coin.first);
+            if (it == batch.totals.end()) {
+                size += Amino::fieldSize(tokenSize(coin.first, coin.second));
+            } else if (coin.second > std::numeric_limits<int64_t>::max() - it->second) {
+                overflow = true;
+            } else {
+                size -= Amino::fieldSize(tokenSize(coin.first, it->second));
+                size += Amino::fieldSize(tokenSize(coin.first, it->second + coin.second));
+            }
+        }
+        return size;
+    };
+
+    for (size_t i = 0; i < outputs.size(); i += 1) {
+        const auto& output = outputs[i];
+        const auto outputSize = Amino::fieldSize(Amino::fieldSize(output.address.size()) + coinsSize(output.coins));
+
+        auto overflow = false;
+        auto inputCoinsSize = inputCoinsSizeWith(batch, output, overflow);
+        auto fits = !overflow && batch.count < maxOutputs &&
+            transactionSize(inputCoinsSize, batch.outputsSize + outputSize, batches.size()) <= maxSize;
+        if (!fits && batch.count > 0) {
+            batches.push_back(std::move(batch));
+            batch = Batch();
+            batch.begin = i;
+            inputCoinsSize = inputCoinsSizeWith(batch, output, overflow);
+            fits = maxOutputs > 0 && transactionSize(inputCoinsSize, outputSize, batches.size()) <= maxSize;
+        }
+        if (!fits) {
+            throw std::invalid_argument("Payout does not fit in a transaction");
+        }
+
+        for (auto& coin : output.coins) {
+            batch.totals[coin.first] += coin.second;
+        }
+        batch.inputCoinsSize = inputCoinsSize;
+        batch.outputsSize += outputSize;
+        batch.count += 1;
+    }
+    if (batch.count > 0) {
+        batches.push_back(std::move(batch));
+    }
+
+    std::vector<Send> messages(batches.size());
+    for (size_t i = 0; i < batches.size(); i += 1) {
+        auto& send = messages[i];
+        auto input = send.add_inputs();
+        input->set_address(sender.data(), sender.size());
+        for (auto& total : batches[i].totals) {
+            auto coin = input->add_coins();
+            coin->set_denom(total.first);
+            coin->set_amount(total.second);
+        }
+        for (size_t j = batches[i].begin; j < batches[i].begin + batches[i].count; j += 1) {
+            auto output = send.add_outputs();
+            output->set_address(outputs[j].address.data(), outputs[j].address.size());
+            for (auto& token : outputs[j].coins) {
+                auto coin = output->add_coins();
+                coin->set_denom(token.first);
+                coin->set_amount(token.second);
+            }
+        }
+    }
+    return messages;
+}
+
+std::vector<Data> PayoutBuilder::build() const {
+    const auto messages = pack();
+    std::vector<Data> transactions(messages.size());
+
+    auto workers = threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+    workers = std::min(workers, messages.size());
+
+    std::atomic<size_t> next(0);
+    std::atomic<bool> failed(false);
+    auto work = [&]() {
+        for (auto i = next++; i < messages.size() && !failed; i = next++) {
+            auto signer = Signer(messages[i]);
+            signer.chainId = chainId;
+            signer.accountNumber = accountNumber;
+            signer.sequence = sequence + static_cast<int64_t>(i);
+            signer.source = source;
+            signer.memo = memo;
+            signer.privateKey = PrivateKey(privateKey);
+            transactions[i] = signer.build();
+            if (transactions[i].empty()) {
+                failed = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (size_t i = 1; i < workers; i += 1) {
+        pool.emplace_back(work);
+    }
+    work();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    if (failed) {
+        throw std::runtime_error("Signing failed");
+    }
+    return transactions;
+}
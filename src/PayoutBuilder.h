@@ -0,0 +1,91 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include "dex.pb.h"
+#include "Data.h"
+
+#include <map>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Binance {
+
+/// Packs a large number of payouts into as few `Send` transactions as possible.
+///
+/// Payouts to the same recipient are merged into one output and coins are sorted by denomination. Batches are cut
+/// using exact encoded sizes, so every message is serialized only once, and batches are signed in parallel with
+/// consecutive sequence numbers.
+class PayoutBuilder {
+public:
+    /// Default maximum number of outputs per `Send` message.
+    static constexpr size_t defaultMaxOutputs = 1000;
+
+    /// Chain identifier.
+    std::string chainId;
+
+    /// Signer's account number.
+    int64_t accountNumber;
+
+    /// Sequence number of the first transaction, each following batch uses the next one.
+    int64_t sequence;
+
+    /// Source identifier, set to zero if unwilling to disclose.
+    int64_t source;
+
+    /// A short remark attached to every transaction.
+    std::string memo;
+
+    /// Private signing key, the sender address is derived from it.
+    Data privateKey;
+
+    /// Maximum number of outputs per transaction.
+    size_t maxOutputs;
+
+    /// Maximum encoded transaction size, including the length prefix.
+    size_t maxSize;
+
+    /// Number of signing threads, zero to use all cores.
+    size_t threads;
+
+    /// Initializes an empty payout builder.
+    PayoutBuilder();
+
+    /// Adds a payout.
+    ///
+    /// \returns `false` if the amount is not positive, the denomination is empty or the recipient's total would overflow.
+    bool add(const Data& address, const std::string& denom, int64_t amount);
+
+    /// Number of distinct recipients.
+    size_t recipients() const { return outputs.size(); }
+
+    /// Packs payouts into `Send` messages.
+    ///
+    /// \throws std::invalid_argument if a single recipient does not fit in a transaction.
+    std::vector<Send> pack() const;
+
+    /// Packs and signs all payouts.
+    ///
+    /// \returns the signed transactions in sequence order, empty only if there are no payouts.
+    /// \throws std::invalid_argument if a single recipient does not fit in a transaction.
+    /// \throws std::runtime_error if a transaction cannot be signed, for example because the memo is not valid UTF-8.
+    std::vector<Data> build() const;
+
+private:
+    struct Output {
+        Data address;
+        std::map<std::string, int64_t> coins;
+    };
+
+    std::vector<Output> outputs;
+    std::unordered_map<std::string, size_t> index;
+};
+
+} // namespace
@@ -0,0 +1,172 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "PublicKeyCache.h"
+
+#include "crypto/secp256k1.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+using namespace Binance;
+
+PublicKeyCache::PublicKeyCache(size_t capacity, bool tables, size_t shards)
+    : shardCapacity(std::max<size_t>(capacity / std::max<size_t>(shards, 1), 1)),
+      tables(tables),
+      shards(new Shard[std::max<size_t>(shards, 1)]),
+      shardCount(std::max<size_t>(shards, 1)) {
+    for (size_t i = 0; i < shardCount; i += 1) {
+        this->shards[i].slots.reset(new Slot[shardCapacity]);
+        if (tables) {
+            this->shards[i].tables.reset(new Table[shardCapacity]);
+        }
+    }
+}
+
+size_t PublicKeyCache::KeyHash::operator()(const Key& key) const {
+    // Skip the parity prefix, the x coordinate is uniform.
+    size_t hash;
+    std::memcpy(&hash, key.data() + 1, sizeof(hash));
+    return hash;
+}
+
+PublicKeyCache::Shard& PublicKeyCache::shard(const Key& key) {
+    uint64_t index;
+    std::memcpy(&index, key.data() + 1 + sizeof(size_t), sizeof(index));
+    return shards[index % shardCount];
+}
+
+bool PublicKeyCache::lookup(Shard& shard, const Key& key, curve_point& point, Table* table) {
+    std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it == shard.index.end()) {
+        return false;
+    }
+    auto& slot = shard.slots[it->second];
+    slot.referenced.store(true, std::memory_order_relaxed);
+    point = slot.point;
+    if (table != nullptr) {
+        *table = shard.tables[it->second];
+    }
+    return true;
+}
+
+bool PublicKeyCache::load(Shard& shard, const Key& key, curve_point& point, Table* table) {
+    if ((key[0] != 0x02 && key[0] != 0x03) || !ecdsa_read_pubkey(&secp256k1, key.data(), &point)) {
+        shard.invalid += 1;
+        return false;
+    }
+    // Build the table outside the lock, two threads missing on the same key may both do the work.
+    Table computed;
+    if (tables) {
+        ecdsa_point_table(&secp256k1, &point, computed.data());
+        if (table != nullptr) {
+            *table = computed;
+        }
+    }
+
+    std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+    if (shard.index.find(key) != shard.index.end()) {
+        return true;
+    }
+    // Sweep the hand, clearing reference bits, until an unused or unreferenced slot comes up.
+    size_t index;
+    while (true) {
+        auto& slot = shard.slots[shard.hand];
+        index = shard.hand;
+        shard.hand = (shard.hand + 1) % shardCapacity;
+        if (!slot.used || !slot.referenced.exchange(false, std::memory_order_relaxed)) {
+            break;
+        }
+    }
+    auto& slot = shard.slots[index];
+    if (slot.used) {
+        shard.index.erase(slot.key);
+        shard.evictions += 1;
+    }
+    slot.key = key;
+    slot.point = point;
+    slot.used = true;
+    slot.referenced.store(false, std::memory_order_relaxed);
+    if (tables) {
+        shard.tables[index] = computed;
+    }
+    shard.index.emplace(key, index);
+    shard.insertions += 1;
+    return true;
+}
+
+bool PublicKeyCache::find(const uint8_t* publicKey, curve_point& point) {
+    Key key;
+    std::copy(publicKey, publicKey + keySize, key.begin());
+    auto& shard = this->shard(key);
+    if (lookup(shard, key, point, nullptr)) {
+        shard.hits += 1;
+        return true;
+    }
+    shard.misses += 1;
+    return load(shard, key, point, nullptr);
+}
+
+bool PublicKeyCache::verify(const uint8_t* publicKey, const uint8_t* signature, const uint8_t* digest) {
+    Key key;
+    std::copy(publicKey, publicKey + keySize, key.begin());
+    auto& shard = this->shard(key);
+    curve_point point;
+    Table table;
+    if (lookup(shard, key, point, tables ? &table : nullptr)) {
+        shard.hits += 1;
+    } else {
+        shard.misses += 1;
+        if (!load(shard, key, point, tables ? &table : nullptr)) {
+            return false;
+        }
+    }
+    if (tables) {
+        return ecdsa_verify_digest_table(&secp256k1, table.data(), signature, digest) == 0;
+    }
+    return ecdsa_verify_digest_point(&secp256k1, &point, signature, digest) == 0;
+}
+
+size_t PublicKeyCache::prewarm(const std::vector<Data>& publicKeys) {
+    size_t valid = 0;
+    for (const auto& publicKey : publicKeys) {
+        curve_point point;
+        if (publicKey.size() == keySize && find(publicKey.data(), point)) {
+            valid += 1;
+        }
+    }
+    return valid;
+}
+
+void PublicKeyCache::clear() {
+    for (size_t i = 0; i < shardCount; i += 1) {
+        auto& shard = shards[i];
+        std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+        shard.index.clear();
+        for (size_t j = 0; j < shardCapacity; j += 1) {
+            shard.slots[j].used = false;
+        }
+        shard.hand = 0;
+    }
+}
+
+PublicKeyCache::Stats PublicKeyCache::stats() const {
+    auto stats = Stats();
+    for (size_t i = 0; i < shardCount; i += 1) {
+        const auto& shard = shards[i];
+        std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+        stats.hits += shard.hits;
+        stats.misses += shard.misses;
+        stats.insertions += shard.insertions;
+        stats.evictions += shard.evictions;
+        stats.invalid += shard.invalid;
+        stats.size += shard.index.size();
+    }
+    return stats;
+}
@@ -0,0 +1,119 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include "Data.h"
+#include "crypto/ecdsa.h"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+namespace Binance {
+
+/// Bounded cache of decompressed and validated public keys.
+///
+/// Reading a compressed key takes a modular square root and an on-curve check, which this cache skips for keys seen
+/// before. Entries are replaced with the CLOCK algorithm: lookups only set a reference bit under a shared lock, and
+/// insertions sweep a hand over the slots, evicting the first entry not referenced since the last sweep.
+///
+/// With `tables` enabled each entry also holds the odd multiples of the key, and verifications use a joint
+/// double-scalar multiplication instead of two separate ones.
+class PublicKeyCache {
+public:
+    /// Cache counters, summed over all shards.
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t insertions = 0;
+        uint64_t evictions = 0;
+
+        /// Keys that failed to decode or validate, those are never cached.
+        uint64_t invalid = 0;
+        size_t size = 0;
+
+        double hitRate() const { return hits + misses == 0 ? 0 : double(hits) / double(hits + misses); }
+    };
+
+    /// Size of a compressed public key.
+    static const size_t keySize = 33;
+
+    /// Initializes a cache holding up to `capacity` keys, spread over `shards` shards.
+    explicit PublicKeyCache(size_t capacity, bool tables = false, size_t shards = 16);
+
+    /// Finds a key, decompressing and caching it on a miss.
+    ///
+    /// \returns `false` if the key is not a valid compressed public key.
+    bool find(const uint8_t* publicKey, curve_point& point);
+
+    /// Verifies a signature with a cached key.
+    ///
+    /// \param publicKey 33-byte compressed public key.
+    /// \param signature 64-byte signature.
+    /// \param digest 32-byte message digest.
+    /// \returns `true` if the key and the signature are valid.
+    bool verify(const uint8_t* publicKey, const uint8_t* signature, const uint8_t* digest);
+
+    /// Decompresses and caches known hot keys ahead of time.
+    ///
+    /// \returns the number of valid keys.
+    size_t prewarm(const std::vector<Data>& publicKeys);
+
+    /// Removes all entries, counters are kept.
+    void clear();
+
+    Stats stats() const;
+
+private:
+    using Key = std::array<uint8_t, keySize>;
+    using Table = std::array<curve_point, 8>;
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Slot {
+        Key key;
+        curve_point point;
+        std::atomic<bool> referenced{false};
+        bool used = false;
+    };
+
+    struct Shard {
+        mutable std::shared_timed_mutex mutex;
+        std::unique_ptr<Slot[]> slots;
+        std::unique_ptr<Table[]> tables;
+        std::unordered_map<Key, size_t, KeyHash> index;
+        size_t hand = 0;
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+        uint64_t insertions = 0;
+        uint64_t evictions = 0;
+        std::atomic<uint64_t> invalid{0};
+    };
+
+    Shard& shard(const Key& key);
+
+    /// Looks a key up, copying its point and table out.
+    bool lookup(Shard& shard, const Key& key, curve_point& point, Table* table);
+
+    /// Reads, validates and caches a key.
+    bool load(Shard& shard, const Key& key, curve_point& point, Table* table);
+
+    const size_t shardCapacity;
+    const bool tables;
+    std::unique_ptr<Shard[]> shards;
+    const size_t shardCount;
+};
+
+} // namespace
@@ -0,0 +1,74 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Recovery.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/secp256k1.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace Binance;
+
+/// Number of signatures a thread recovers per call into the batch API.
+static const size_t chunkSize = 256;
+
+static inline void compress(const uint8_t uncompressed[65], uint8_t compressed[33]) {
+    compressed[0] = 0x02 | (uncompressed[64] & 0x01);
+    std::copy(uncompressed + 1, uncompressed + 33, compressed + 1);
+}
+
+Data Binance::recoverPublicKey(const uint8_t signature[64], const uint8_t digest[32], uint8_t recoveryId) {
+    uint8_t uncompressed[65];
+    if (recoveryId > 3 || ecdsa_recover_pub_from_sig(&secp256k1, uncompressed, signature, digest, recoveryId) != 0) {
+        return {};
+    }
+    Data publicKey(33);
+    compress(uncompressed, publicKey.data());
+    return publicKey;
+}
+
+size_t Binance::recoverPublicKeys(const uint8_t* signatures, const uint8_t* digests, const uint8_t* recoveryIds, size_t count,
+    uint8_t* publicKeys, bool* results, size_t threads) {
+    if (threads == 0) {
+        threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    threads = std::max<size_t>(std::min(threads, (count + chunkSize - 1) / chunkSize), 1);
+
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> recovered{0};
+    auto work = [&]() {
+        uint8_t uncompressed[chunkSize * 65];
+        int status[chunkSize];
+        size_t total = 0;
+        for (auto offset = next.fetch_add(chunkSize); offset < count; offset = next.fetch_add(chunkSize)) {
+            const auto size = std::min(chunkSize, count - offset);
+            total += ecdsa_recover_pub_from_sig_batch(&secp256k1, uncompressed, signatures + 64 * offset, digests + 32 * offset,
+                recoveryIds + offset, status, size);
+            for (size_t i = 0; i < size; i += 1) {
+                results[offset + i] = status[i] == 0;
+                if (status[i] == 0) {
+                    compress(uncompressed + 65 * i, publicKeys + 33 * (offset + i));
+                }
+            }
+        }
+        recovered += total;
+    };
+
+    std::vector<std::thread> pool;
+    for (size_t i = 1; i < threads; i += 1) {
+        pool.emplace_back(work);
+    }
+    work();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    return recovered;
+}
@@ -0,0 +1,34 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include "Data.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Binance {
+
+/// Recovers the public key of a signature.
+///
+/// \returns the compressed public key or an empty vector if no key can be recovered or `recoveryId` is not 0 to 3.
+Data recoverPublicKey(const uint8_t signature[64], const uint8_t digest[32], uint8_t recoveryId);
+
+/// Recovers public keys in bulk, splitting the signatures over `threads` threads.
+///
+/// Each thread recovers its share in chunks that share their field inversions and uses a joint double-scalar
+/// multiplication per key. Inputs are packed: `count` 64-byte signatures, 32-byte digests and recovery ids.
+///
+/// \param publicKeys receives `count` 33-byte compressed public keys.
+/// \param results receives whether each key was recovered.
+/// \param threads number of threads, zero to use all cores.
+/// \returns the number of keys recovered.
+size_t recoverPublicKeys(const uint8_t* signatures, const uint8_t* digests, const uint8_t* recoveryIds, size_t count,
+    uint8_t* publicKeys, bool* results, size_t threads = 0);
+
+} // namespace
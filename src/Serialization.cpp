@@ -7,35 +7,56 @@
 
 #include "Serialization.h"
 
-#include "Address.h"
+#include "Bech32.h"
+#include "Instrumentation.h"
 #include "Signer.h"
+#include "TransactionBuilder.h"
 
 using namespace Binance;
 using json = nlohmann::json;
 
+/// Encodes a key hash as a mainnet address, empty if it is not a valid witness program size.
 static inline std::string addressString(const std::string& bytes) {
-    auto data = std::vector<uint8_t>(bytes.begin(), bytes.end());
-    auto address = Address(Address::binanceHRP, data);
-    return address.encode();
+    if (bytes.size() < 2 || bytes.size() > 40) {
+        return {};
+    }
+    static const char hrp[] = "bnb";
+    char encoded[Bech32::encodedSize(sizeof(hrp) - 1, 40)];
+    const auto data = reinterpret_cast<const byte*>(bytes.data());
+    return std::string(encoded, Bech32::encode(hrp, sizeof(hrp) - 1, data, bytes.size(), encoded));
 }
 
-std::string Binance::signaturePreimage(const Signer& signer) {
+static std::string preimage(const std::string& chainId, int64_t accountNumber, int64_t sequence, int64_t source, const std::string& memo, json&& msgs) {
     json j;
-    j["account_number"] = std::to_string(signer.accountNumber);
-    j["chain_id"] = signer.chainId;
+    j["account_number"] = std::to_string(accountNumber);
+    j["chain_id"] = chainId;
     j["data"] = nullptr;
-    j["memo"] = signer.memo;
-    j["msgs"] = json::array({ orderJSON(signer.order) });
-    j["sequence"] = std::to_string(signer.sequence);
-    j["source"] = std::to_string(signer.source);
+    j["memo"] = memo;
+    j["msgs"] = std::move(msgs);
+    j["sequence"] = std::to_string(sequence);
+    j["source"] = std::to_string(source);
     return j.dump();
 }
 
+std::string Binance::signaturePreimage(const Signer& signer) {
+    BINANCE_INSTRUMENT(preimage);
+    return preimage(signer.chainId, signer.accountNumber, signer.sequence, signer.source, signer.memo, json::array({ orderJSON(*signer.order) }));
+}
+
+std::string Binance::signaturePreimage(const TransactionBuilder& builder) {
+    BINANCE_INSTRUMENT(preimage);
+    json msgs = json::array();
+    for (auto order : builder.orders()) {
+        msgs.push_back(orderJSON(*order));
+    }
+    return preimage(builder.chainId, builder.accountNumber, builder.sequence, builder.source, builder.memo, std::move(msgs));
+}
+
 json Binance::orderJSON(const ::google::protobuf::Message& order) {
     json j;
-    const auto typeName = order.GetTypeName();
-    if (typeName == NewOrder::descriptor()->full_name()) {
-        auto tradeOrder = reinterpret_cast<const NewOrder&>(order);
+    const auto descriptor = order.GetDescriptor();
+    if (descriptor == NewOrder::descriptor()) {
+        const auto& tradeOrder = reinterpret_cast<const NewOrder&>(order);
         j["id"] = tradeOrder.id();
         j["ordertype"] = 2;
         j["price"] = tradeOrder.price();
@@ -44,22 +65,22 @@ json Binance::orderJSON(const ::google::protobuf::Message& order) {
         j["side"] = tradeOrder.side();
         j["symbol"] = tradeOrder.symbol();
         j["timeinforce"] = tradeOrder.timeinforce();
-    } else if (typeName == CancelOrder::descriptor()->full_name()) {
-        auto cancelOrder = reinterpret_cast<const CancelOrder&>(order);
+    } else if (descriptor == CancelOrder::descriptor()) {
+        const auto& cancelOrder = reinterpret_cast<const CancelOrder&>(order);
         j["refid"] = cancelOrder.refid();
         j["sender"] = cancelOrder.sender();
         j["symbol"] = cancelOrder.symbol();
-    } else if (typeName == Send::descriptor()->full_name()) {
-        auto send = reinterpret_cast<const Send&>(order);
+    } else if (descriptor == Send::descriptor()) {
+        const auto& send = reinterpret_cast<const Send&>(order);
         j["inputs"] = inputsJSON(send);
         j["outputs"] = outputsJSON(send);
-    } else if (typeName == TokenFreeze::descriptor()->full_name()) {
-        auto freeze = reinterpret_cast<const TokenFreeze&>(order);
+    } else if (descriptor == TokenFreeze::descriptor()) {
+        const auto& freeze = reinterpret_cast<const TokenFreeze&>(order);
         j["from"] = addressString(freeze.from());
         j["symbol"] = freeze.symbol();
         j["amount"] = freeze.amount();
-    } else if (typeName == TokenUnfreeze::descriptor()->full_name()) {
-        auto unfreeze = reinterpret_cast<const TokenUnfreeze&>(order);
+    } else if (descriptor == TokenUnfreeze::descriptor()) {
+        const auto& unfreeze = reinterpret_cast<const TokenUnfreeze&>(order);
         j["from"] = addressString(unfreeze.from());
         j["symbol"] = unfreeze.symbol();
         j["amount"] = unfreeze.amount();
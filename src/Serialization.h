@@ -13,8 +13,10 @@
 namespace Binance {
 
 class Signer;
+class TransactionBuilder;
 
 std::string signaturePreimage(const Signer& signer);
+std::string signaturePreimage(const TransactionBuilder& builder);
 nlohmann::json orderJSON(const ::google::protobuf::Message& order);
 nlohmann::json inputsJSON(const Binance::Send& order);
 nlohmann::json outputsJSON(const Binance::Send& order);
@@ -0,0 +1,120 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "SignatureCache.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/secp256k1.h"
+#include "crypto/sha2.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace Binance;
+
+SignatureCache::SignatureCache(size_t capacity, size_t shards, Eviction eviction)
+    : shardCapacity(std::max<size_t>(capacity / std::max<size_t>(shards, 1), 1)),
+      eviction(eviction),
+      shards(new Shard[std::max<size_t>(shards, 1)]),
+      shardCount(std::max<size_t>(shards, 1)) {}
+
+size_t SignatureCache::KeyHash::operator()(const Key& key) const {
+    // The key is already a cryptographic hash, any slice of it is uniform.
+    size_t hash;
+    std::memcpy(&hash, key.data(), sizeof(hash));
+    return hash;
+}
+
+SignatureCache::Key SignatureCache::key(const uint8_t* publicKey, const uint8_t* signature, const uint8_t* digest) {
+    Key key;
+    SHA256_CTX context;
+    sha256_Init(&context);
+    sha256_Update(&context, publicKey, 33);
+    sha256_Update(&context, digest, 32);
+    sha256_Update(&context, signature, 64);
+    sha256_Final(&context, key.data());
+    return key;
+}
+
+SignatureCache::Shard& SignatureCache::shard(const Key& key) {
+    // Use different bytes than the hash table so entries spread evenly within a shard.
+    uint64_t index;
+    std::memcpy(&index, key.data() + 8, sizeof(index));
+    return shards[index % shardCount];
+}
+
+bool SignatureCache::find(const Key& key) {
+    auto& shard = this->shard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end()) {
+        shard.misses += 1;
+        return false;
+    }
+    shard.hits += 1;
+    if (eviction == Eviction::lru) {
+        shard.order.splice(shard.order.begin(), shard.order, it->second);
+    }
+    return true;
+}
+
+void SignatureCache::insert(const Key& key) {
+    auto& shard = this->shard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.entries.find(key) != shard.entries.end()) {
+        return;
+    }
+    if (shard.entries.size() >= shardCapacity) {
+        shard.entries.erase(shard.order.back());
+        shard.order.pop_back();
+        shard.evictions += 1;
+    }
+    shard.order.push_front(key);
+    shard.entries.emplace(key, shard.order.begin());
+    shard.insertions += 1;
+}
+
+bool SignatureCache::verify(const uint8_t* publicKey, const uint8_t* signature, const uint8_t* digest) {
+    const auto key = SignatureCache::key(publicKey, signature, digest);
+    if (find(key)) {
+        return true;
+    }
+    if (ecdsa_verify_digest(&secp256k1, publicKey, signature, digest) != 0) {
+        return false;
+    }
+    insert(key);
+    return true;
+}
+
+bool SignatureCache::contains(const uint8_t* publicKey, const uint8_t* signature, const uint8_t* digest) {
+    return find(key(publicKey, signature, digest));
+}
+
+void SignatureCache::insert(const uint8_t* publicKey, const uint8_t* signature, const uint8_t* digest) {
+    insert(key(publicKey, signature, digest));
+}
+
+void SignatureCache::clear() {
+    for (size_t i = 0; i < shardCount; i += 1) {
+        std::lock_guard<std::mutex> lock(shards[i].mutex);
+        shards[i].entries.clear();
+        shards[i].order.clear();
+    }
+}
+
+SignatureCache::Stats SignatureCache::stats() const {
+    auto stats = Stats();
+    for (size_t i = 0; i < shardCount; i += 1) {
+        std::lock_guard<std::mutex> lock(shards[i].mutex);
+        stats.hits += shards[i].hits;
+        stats.misses += shards[i].misses;
+        stats.insertions += shards[i].insertions;
+        stats.evictions += shards[i].evictions;
+        stats.size += shards[i].entries.size();
+    }
+    return stats;
+}
@@ -0,0 +1,99 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include <array>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <unordered_map>
+
+namespace Binance {
+
+/// Bounded cache of successful signature verifications.
+///
+/// Entries are keyed by the SHA-256 hash of the public key, digest and signature, so a hit proves the exact triple was
+/// verified before. Only valid signatures are cached; invalid ones are verified again every time. The cache is split
+/// into shards with their own lock so concurrent verifiers rarely contend.
+class SignatureCache {
+public:
+    /// Which entry to drop when a shard is full.
+    enum class Eviction {
+        /// Drop the least recently used entry, hits refresh an entry.
+        lru,
+
+        /// Drop the oldest entry, hits don't modify the shard.
+        fifo,
+    };
+
+    /// Cache counters, summed over all shards.
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t insertions = 0;
+        uint64_t evictions = 0;
+        size_t size = 0;
+
+        double hitRate() const { return hits + misses == 0 ? 0 : double(hits) / double(hits + misses); }
+    };
+
+    using Key = std::array<uint8_t, 32>;
+
+    /// Initializes a cache holding up to `capacity` verifications, spread over `shards` shards.
+    explicit SignatureCache(size_t capacity, size_t shards = 16, Eviction eviction = Eviction::lru);
+
+    /// Verifies a signature, consulting the cache first.
+    ///
+    /// \param publicKey 33-byte compressed public key.
+    /// \param signature 64-byte signature.
+    /// \param digest 32-byte message digest.
+    /// \returns `true` if the signature is valid.
+    bool verify(const uint8_t* publicKey, const uint8_t* signature, const uint8_t* digest);
+
+    /// Whether a verification is cached, counts as a hit or a miss.
+    bool contains(const uint8_t* publicKey, const uint8_t* signature, const uint8_t* digest);
+
+    /// Records a verification done by the caller.
+    void insert(const uint8_t* publicKey, const uint8_t* signature, const uint8_t* digest);
+
+    /// Removes all entries, counters are kept.
+    void clear();
+
+    Stats stats() const;
+
+    /// Computes the cache key of a verification.
+    static Key key(const uint8_t* publicKey, const uint8_t* signature, const uint8_t* digest);
+
+private:
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        std::list<Key> order;
+        std::unordered_map<Key, std::list<Key>::iterator, KeyHash> entries;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t insertions = 0;
+        uint64_t evictions = 0;
+    };
+
+    Shard& shard(const Key& key);
+    bool find(const Key& key);
+    void insert(const Key& key);
+
+    const size_t shardCapacity;
+    const Eviction eviction;
+    std::unique_ptr<Shard[]> shards;
+    const size_t shardCount;
+};
+
+} // namespace
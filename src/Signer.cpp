@@ -6,125 +6,209 @@
 // code distribution tree.
 
 #include "Signer.h"
-#include "Serialization.h"
+#include "Amino.h"
+#include "Instrumentation.h"
+#include "Verifier.h"
 
 #include "crypto/ecdsa.h"
 #include "crypto/secp256k1.h"
 #include "crypto/sha2.h"
 
-#include <nlohmann/json.hpp>
-#include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <algorithm>
 #include <string>
 
 using namespace Binance;
 
-// Message prefixes
-static const auto sendOrderPrefix = Data{ 0x2A, 0x2C, 0x87, 0xFA };
-static const auto tradeOrderPrefix = Data{ 0xCE, 0x6D, 0xC0, 0x43 };
-static const auto cancelTradeOrderPrefix = Data{ 0x16, 0x6E, 0x68, 0x1B };
-static const auto tokenFreezeOrderPrefix = Data{ 0xE7, 0x74, 0xB3, 0x2D };
-static const auto tokenUnfreezeOrderPrefix = Data{ 0x65, 0x15, 0xFF, 0x0D };
-static const auto pubKeyPrefix = Data{ 0xEB, 0x5A, 0xE9, 0x87 };
-static const auto transactionPrefix = Data{ 0xF0, 0x62, 0x5D, 0xEE };
-
 Data Signer::build() const {
-    auto signature = sign();
-    if (signature.empty()) {
+    BINANCE_INSTRUMENT(build);
+    const auto messageSize = orderSize();
+    if (messageSize == 0) {
         return {};
     }
-
-    auto encoded = encodeSignature(signature);
-    return encodeTransaction(encoded);
+    auto transaction = Data(transactionSize(messageSize));
+    if (!writeTransaction(transaction.data(), messageSize)) {
+        return {};
+    }
+    return transaction;
 }
 
-Data Signer::sign() const {
-    const auto preImage = signaturePreimage(*this);
-
-    byte hash[SHA256_DIGEST_LENGTH];
-    sha256_Raw(reinterpret_cast<const byte*>(preImage.data()), preImage.size(), hash);
+ByteSpan Signer::build(Arena& arena) const {
+    BINANCE_INSTRUMENT(build);
+    const auto messageSize = orderSize();
+    if (messageSize == 0) {
+        return {};
+    }
+    const auto size = transactionSize(messageSize);
+    const auto transaction = static_cast<byte*>(arena.allocate(size, 1));
+    if (!writeTransaction(transaction, messageSize)) {
+        return {};
+    }
+    return ByteSpan(transaction, size);
+}
 
-    byte sig[64];
-    if (-1 == ecdsa_sign_digest(&secp256k1, privateKey.data(), hash, sig, nullptr, nullptr)) {
+ByteSpan Signer::build(Span<byte> buffer) const {
+    BINANCE_INSTRUMENT(build);
+    const auto messageSize = orderSize();
+    if (messageSize == 0) {
         return {};
     }
+    const auto size = transactionSize(messageSize);
+    if (size > buffer.size() || !writeTransaction(buffer.data(), messageSize)) {
+        return {};
+    }
+    return ByteSpan(buffer.data(), size);
+}
 
-    return Data(sig, sig + 64);
+size_t Signer::encodedSize() const {
+    const auto messageSize = orderSize();
+    return messageSize == 0 ? 0 : transactionSize(messageSize);
 }
 
-Data Signer::encodeTransaction(const Data& signature) const {
-    auto msg = encodeOrder();
-    auto transaction = Binance::Transaction();
-    transaction.add_msgs(msg.data(), msg.size());
-    transaction.add_signatures(signature.data(), signature.size());
-    transaction.set_memo(memo);
-    transaction.set_source(source);
-    
-    auto data = transaction.SerializeAsString();
-    return aminoWrap(data, transactionPrefix, true);
+size_t Signer::orderSize() const {
+#ifndef BINANCE_NO_PROTOBUF
+    if (order != nullptr) {
+        const auto prefix = Amino::orderPrefix(*order);
+        return prefix == nullptr ? 0 : prefix->size() + order->ByteSizeLong();
+    }
+#endif
+    return encodedOrder.size();
 }
 
-Data Signer::encodeOrder() const {
-    std::string data;
-    Data prefix;
-    const auto typeName = order.GetTypeName();
-    if (typeName == NewOrder::descriptor()->full_name()) {
-        data = order.SerializeAsString();
-        prefix = tradeOrderPrefix;
-    } else if (typeName == CancelOrder::descriptor()->full_name()) {
-        data = order.SerializeAsString();
-        prefix = cancelTradeOrderPrefix;
-    } else if (typeName == Send::descriptor()->full_name()) {
-        data = order.SerializeAsString();
-        prefix = sendOrderPrefix;
-    } else if (typeName == TokenFreeze::descriptor()->full_name()) {
-        data = order.SerializeAsString();
-        prefix = tokenFreezeOrderPrefix;
-    } else if (typeName == TokenUnfreeze::descriptor()->full_name()) {
-        data = order.SerializeAsString();
-        prefix = tokenUnfreezeOrderPrefix;
-    } else {
-        return {};
+byte* Signer::writeOrder(byte* out) const {
+#ifndef BINANCE_NO_PROTOBUF
+    if (order != nullptr) {
+        const auto prefix = Amino::orderPrefix(*order);
+        out = std::copy(prefix->begin(), prefix->end(), out);
+        return order->SerializeWithCachedSizesToArray(out);
     }
-    return aminoWrap(data, prefix, false);
+#endif
+    return std::copy(encodedOrder.begin(), encodedOrder.end(), out);
 }
 
-Data Signer::encodeSignature(const Data& signature) const {
-    Data publicKey;
-    publicKey.resize(33);
-    ecdsa_get_public_key33(&secp256k1, privateKey.data(), publicKey.data());
+bool Signer::isWellFormed(ByteSpan message) const {
+    // Orders from the protobuf classes are well formed, encoded orders are validated before decoding lazily.
+#ifndef BINANCE_NO_PROTOBUF
+    if (order != nullptr) {
+        return true;
+    }
+#endif
+    Amino::MessageView view;
+    return Amino::MessageView::decode(message, view);
+}
 
-    auto encodedPublicKey = pubKeyPrefix;
-    encodedPublicKey.insert(encodedPublicKey.end(), static_cast<uint8_t>(publicKey.size()));
-    encodedPublicKey.insert(encodedPublicKey.end(), publicKey.begin(), publicKey.end());
+size_t Signer::transactionSize(size_t messageSize) const {
+    const auto signatureSize = Amino::signatureEncodedSize(accountNumber, sequence);
+    const auto contentsSize = Amino::transactionContentsSize(Amino::fieldSize(messageSize), signatureSize, memo, source);
+    return Amino::varintSize(contentsSize) + contentsSize;
+}
 
-    auto object = Binance::Signature();
-    object.set_pub_key(encodedPublicKey.data(), encodedPublicKey.size());
-    object.set_signature(signature.data(), signature.size());
-    object.set_account_number(accountNumber);
-    object.set_sequence(sequence);
+bool Signer::writeTransaction(byte* transaction, size_t messageSize) const {
+    const auto signatureSize = Amino::signatureEncodedSize(accountNumber, sequence);
+    const auto contentsSize = Amino::transactionContentsSize(Amino::fieldSize(messageSize), signatureSize, memo, source);
 
-    return aminoWrap(object.SerializeAsString(), {}, false);
+    // Lay out the transaction with a gap for the signature, which needs the preimage of the encoded order.
+    byte* signatureField;
+    Amino::TransactionView view;
+    {
+        BINANCE_INSTRUMENT(encode);
+        auto out = Amino::writeVarint(transaction, contentsSize);
+        out = std::copy(Amino::transactionPrefix.begin(), Amino::transactionPrefix.end(), out);
+        const auto msgs = out;
+        *out++ = 1 << 3 | 2;
+        out = Amino::writeVarint(out, messageSize);
+        const auto message = out;
+        out = writeOrder(out);
+
+        if (!isWellFormed(ByteSpan(message, messageSize))) {
+            return false;
+        }
+        view.msgs = Amino::RepeatedView<Amino::MessageView>(ByteSpan(msgs, static_cast<size_t>(out - msgs)), 1, 1);
+
+        signatureField = out;
+        out += Amino::fieldSize(signatureSize);
+        if (!memo.empty()) {
+            out = Amino::writeField(out, 3, ByteSpan(reinterpret_cast<const byte*>(memo.data()), memo.size()));
+        }
+        if (source != 0) {
+            *out++ = 4 << 3;
+            out = Amino::writeVarint(out, static_cast<uint64_t>(source));
+        }
+        view.memo = StringSpan(memo);
+        view.source = source;
+    }
+
+    Amino::SignatureView signatureView;
+    signatureView.accountNumber = accountNumber;
+    signatureView.sequence = sequence;
+    byte hash[SHA256_DIGEST_LENGTH];
+    if (!preimageDigest(view, signatureView, chainId, hash)) {
+        return false;
+    }
+
+    Signature64 signature;
+    int result;
+    {
+        BINANCE_INSTRUMENT(sign);
+        result = ecdsa_sign_digest(&secp256k1, privateKey.data(), hash, signature.data(), nullptr, nullptr);
+    }
+    if (-1 == result) {
+        return false;
+    }
+
+    auto publicKey = this->publicKey;
+    if (publicKey.isZero()) {
+        BINANCE_INSTRUMENT(publicKey);
+        ecdsa_get_public_key33(&secp256k1, privateKey.data(), publicKey.data());
+    }
+    auto out = signatureField;
+    *out++ = 2 << 3 | 2;
+    out = Amino::writeVarint(out, signatureSize);
+    Amino::writeSignature(out, publicKey, signature, accountNumber, sequence);
+    return true;
 }
 
-Data Signer::aminoWrap(const std::string& raw, const Data& typePrefix, bool prefixWithSize) const {
-    const auto contentsSize = raw.size() + typePrefix.size();
-    auto size = contentsSize;
-    if (prefixWithSize) {
-        size += 10;
+Signature64 Signer::sign(uint8_t* recoveryId) const {
+    byte hash[SHA256_DIGEST_LENGTH];
+    if (!hashPreimage(hash)) {
+        return {};
     }
 
-    std::string msg;
-    msg.reserve(size);
+    Signature64 signature;
+    int result;
     {
-        google::protobuf::io::StringOutputStream output(&msg);
-        google::protobuf::io::CodedOutputStream cos(&output);
-        if (prefixWithSize) {
-            cos.WriteVarint64(contentsSize);
-        }
-        cos.WriteRaw(typePrefix.data(), typePrefix.size());
-        cos.WriteRaw(raw.data(), raw.size());
+        BINANCE_INSTRUMENT(sign);
+        result = ecdsa_sign_digest(&secp256k1, privateKey.data(), hash, signature.data(), recoveryId, nullptr);
+    }
+    if (-1 == result) {
+        return {};
+    }
+
+    return signature;
+}
+
+bool Signer::hashPreimage(byte hash[32]) const {
+    const auto messageSize = orderSize();
+    if (messageSize == 0) {
+        return false;
+    }
+
+    // The preimage is streamed from the msgs field of the transaction, as `build()` does.
+    auto msgs = Data(Amino::fieldSize(messageSize));
+    auto out = msgs.data();
+    *out++ = 1 << 3 | 2;
+    out = Amino::writeVarint(out, messageSize);
+    const auto message = out;
+    writeOrder(out);
+    if (!isWellFormed(ByteSpan(message, messageSize))) {
+        return false;
     }
 
-    return Data(msg.begin(), msg.end());
+    Amino::TransactionView view;
+    view.msgs = Amino::RepeatedView<Amino::MessageView>(msgs, 1, 1);
+    view.memo = StringSpan(memo);
+    view.source = source;
+    Amino::SignatureView signatureView;
+    signatureView.accountNumber = accountNumber;
+    signatureView.sequence = sequence;
+    return preimageDigest(view, signatureView, chainId, hash);
 }
@@ -7,8 +7,13 @@
 
 #pragma once
 
+#ifndef BINANCE_NO_PROTOBUF
 #include "dex.pb.h"
+#endif
+#include "Arena.h"
 #include "Data.h"
+#include "FixedData.h"
+#include "Span.h"
 
 #include <stdint.h>
 #include <string>
@@ -37,29 +42,97 @@ public:
     std::string memo;
 
     /// Private signing key.
-    Data privateKey;
+    PrivateKey privateKey;
 
-    /// Order to sign.
-    const ::google::protobuf::Message& order;
+    /// Compressed public key, derived from the private key if all zero.
+    ///
+    /// Callers signing many transactions with the same key can set it once to skip the derivation.
+    PublicKey publicKey;
+
+#ifndef BINANCE_NO_PROTOBUF
+    /// Order to sign, null when signing an encoded order.
+    const ::google::protobuf::Message* order;
+#endif
+
+    /// Order to sign as its Amino encoding with the type prefix, see `Messages::encodeOrder`.
+    ///
+    /// Used when there is no protobuf order. The encoded order must outlive the signer.
+    ByteSpan encodedOrder;
 
+#ifndef BINANCE_NO_PROTOBUF
     /// Initializes a transaction signer.
-    Signer(const ::google::protobuf::Message& order) : chainId("chain-bnb"), accountNumber(), sequence(), source(), memo(), privateKey(), order(order) {}
+    Signer(const ::google::protobuf::Message& order) : chainId("chain-bnb"), accountNumber(), sequence(), source(), memo(), privateKey(), publicKey(), order(&order), encodedOrder() {}
+#endif
+
+    /// Initializes a transaction signer for an encoded order, without the protobuf runtime.
+    explicit Signer(ByteSpan encodedOrder) : chainId("chain-bnb"), accountNumber(), sequence(), source(), memo(), privateKey(), publicKey(),
+#ifndef BINANCE_NO_PROTOBUF
+        order(nullptr),
+#endif
+        encodedOrder(encodedOrder) {}
 
     /// Builds a signed transaction.
     ///
+    /// The transaction is written in place into a single allocation of `encodedSize()` bytes.
+    ///
+    /// Text that is not valid UTF-8 in the memo or the order makes the preimage invalid. This is reported as an error
+    /// like any other; earlier versions threw the JSON library's exception instead.
+    ///
     /// \returns the signed transaction data or an empty vector if there is an error.
     Data build() const;
 
+    /// Builds a signed transaction into a caller buffer, without heap allocations.
+    ///
+    /// \returns the signed transaction at the start of `buffer`, or an empty span if there is an error or the buffer is
+    /// smaller than `encodedSize()`.
+    ByteSpan build(Span<byte> buffer) const;
+
+    /// Builds a signed transaction in an arena, without heap allocations once the arena is large enough.
+    ///
+    /// The preimage is streamed into the hash instead of being built as a string, and the encoded order, signature
+    /// and transaction are written in place into a single arena allocation of the exact size.
+    ///
+    /// \returns the signed transaction, valid until the arena is reset, or an empty span if there is an error.
+    ByteSpan build(Arena& arena) const;
+
+    /// Size of the signed transaction built by `build`, including the length prefix.
+    ///
+    /// Computed from the field sizes without encoding anything, the signature always takes 64 bytes.
+    ///
+    /// \returns the size or zero if the order type is not supported.
+    size_t encodedSize() const;
+
     /// Signs the transaction.
     ///
-    /// \returns the transaction signature or an empty vector if there is an error.
-    Data sign() const;
+    /// The preimage is streamed into its hash as in `build()`, and invalid UTF-8 is reported the same way instead of
+    /// throwing as in earlier versions.
+    ///
+    /// \param recoveryId receives the recovery id of the signature, if not null.
+    /// \returns the transaction signature, all zero if there is an error.
+    Signature64 sign(uint8_t* recoveryId = nullptr) const;
 
 private:
-    Data encodeTransaction(const Data& signature) const;
-    Data encodeOrder() const;
-    Data encodeSignature(const Data& signature) const;
-    Data aminoWrap(const std::string& raw, const Data& typePrefix, bool isPrefixLength) const;
+    /// Size of the order with its type prefix, zero if the order type is not supported.
+    size_t orderSize() const;
+
+    /// Writes the order with its type prefix, `orderSize()` bytes.
+    byte* writeOrder(byte* out) const;
+
+    /// Whether the order written by `writeOrder` decodes.
+    bool isWellFormed(ByteSpan message) const;
+
+    /// Size of the signed transaction with the length prefix, for an order of `messageSize` bytes.
+    size_t transactionSize(size_t messageSize) const;
+
+    /// Writes and signs the transaction, `transactionSize(messageSize)` bytes.
+    ///
+    /// \returns `false` if the order is malformed or signing fails.
+    bool writeTransaction(byte* transaction, size_t messageSize) const;
+
+    /// Hashes the signature preimage.
+    ///
+    /// \returns `false` if the order is malformed or the preimage is not valid JSON text.
+    bool hashPreimage(byte hash[32]) const;
 };
 
 } // namespace
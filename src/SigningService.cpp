@@ -0,0 +1,230 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "SigningService.h"
+#include "Amino.h"
+#include "Signer.h"
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <stdexcept>
+
+using namespace Binance;
+
+constexpr size_t SigningService::sampleCount;
+
+namespace {
+
+/// Ring buffer of the most recent latency samples of a stage.
+struct Samples {
+    std::vector<int64_t> values;
+    size_t next = 0;
+
+    void add(std::chrono::nanoseconds value) {
+        if (values.size() < SigningService::sampleCount) {
+            values.push_back(value.count());
+        } else {
+            values[next] = value.count();
+        }
+        next = (next + 1) % SigningService::sampleCount;
+    }
+};
+
+enum Stage { queueStage, signingStage, totalStage, stageCount };
+
+} // namespace
+
+struct SigningService::Worker {
+    // Queue, the owner takes the oldest order and thieves take the newest.
+    std::mutex queueMutex;
+    std::deque<Job> jobs;
+
+    // Statistics, read by `metrics()`.
+    mutable std::mutex statsMutex;
+    uint64_t completed = 0;
+    uint64_t failed = 0;
+    uint64_t resyncs = 0;
+    uint64_t stolen = 0;
+    std::array<Samples, stageCount> samples;
+};
+
+SigningService::SigningService(AccountRegistry& accounts, const std::string& chainId, size_t threads)
+    : chainId(chainId), accounts(accounts) {
+    if (threads == 0) {
+        threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    for (size_t i = 0; i < threads; i += 1) {
+        workers.emplace_back(new Worker());
+    }
+    for (size_t i = 0; i < threads; i += 1) {
+        pool.emplace_back(&SigningService::run, this, i);
+    }
+}
+
+SigningService::~SigningService() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    condition.notify_all();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+}
+
+std::future<Data> SigningService::submit(const std::string& name, const ::google::protobuf::Message& order) {
+    auto promise = std::make_shared<std::promise<Data>>();
+    auto future = promise->get_future();
+    submit(name, order, [promise](Data transaction, Status) { promise->set_value(std::move(transaction)); });
+    return future;
+}
+
+void SigningService::submit(const std::string& name, const ::google::protobuf::Message& order, Callback callback) {
+    auto job = Job();
+    job.account = accounts.find(name);
+    if (job.account == nullptr) {
+        throw std::invalid_argument("Unknown account");
+    }
+    job.order.reset(order.New());
+    job.order->CopyFrom(order);
+    job.callback = std::move(callback);
+    job.time = Clock::now();
+
+    auto& worker = *workers[std::hash<const Account*>()(job.account.get()) % workers.size()];
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.fetch_add(1, std::memory_order_relaxed);
+    }
+    {
+        std::lock_guard<std::mutex> lock(worker.queueMutex);
+        // Reserve under the queue lock so the worker sees the account's orders in sequence order.
+        job.sequence = job.account->nextSequence();
+        worker.jobs.push_back(std::move(job));
+    }
+    condition.notify_one();
+}
+
+bool SigningService::take(size_t index, Job& job) {
+    auto& own = *workers[index];
+    {
+        std::lock_guard<std::mutex> lock(own.queueMutex);
+        if (!own.jobs.empty()) {
+            job = std::move(own.jobs.front());
+            own.jobs.pop_front();
+            pending.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    for (size_t offset = 1; offset < workers.size(); offset += 1) {
+        auto& victim = *workers[(index + offset) % workers.size()];
+        std::lock_guard<std::mutex> lock(victim.queueMutex);
+        if (!victim.jobs.empty()) {
+            job = std::move(victim.jobs.back());
+            victim.jobs.pop_back();
+            pending.fetch_sub(1, std::memory_order_relaxed);
+
+            std::lock_guard<std::mutex> statsLock(own.statsMutex);
+            own.stolen += 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+void SigningService::run(size_t index) {
+    auto& worker = *workers[index];
+    while (true) {
+        auto job = Job();
+        if (take(index, job)) {
+            process(worker, job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this]() { return stopping || pending.load(std::memory_order_relaxed) > 0; });
+        if (stopping && pending.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+    }
+}
+
+void SigningService::process(Worker& worker, Job& job) {
+    const auto start = Clock::now();
+    auto signer = Signer(*job.order);
+    signer.chainId = chainId;
+    signer.accountNumber = job.account->accountNumber;
+    signer.sequence = job.sequence;
+    signer.privateKey = job.account->privateKey;
+    signer.publicKey = job.account->publicKey;
+    auto transaction = signer.build();
+    const auto end = Clock::now();
+
+    auto status = Status::success;
+    if (transaction.empty()) {
+        // Release the sequence number, a gap makes the chain reject the account's later transactions.
+        status = Status::failed;
+        if (!job.account->rollback(job.sequence)) {
+            job.account->markForResync();
+            status = Status::resyncRequired;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(worker.statsMutex);
+        if (transaction.empty()) {
+            worker.failed += 1;
+            if (status == Status::resyncRequired) {
+                worker.resyncs += 1;
+            }
+        } else {
+            worker.completed += 1;
+        }
+        worker.samples[queueStage].add(start - job.time);
+        worker.samples[signingStage].add(end - start);
+        worker.samples[totalStage].add(end - job.time);
+    }
+    job.callback(std::move(transaction), status);
+}
+
+/// Returns the percentiles of a set of samples, reordering them.
+static SigningService::Percentiles percentiles(std::vector<int64_t>& values) {
+    auto result = SigningService::Percentiles();
+    if (values.empty()) {
+        return result;
+    }
+    auto at = [&values](size_t permille) {
+        auto nth = values.begin() + (values.size() - 1) * permille / 1000;
+        std::nth_element(values.begin(), nth, values.end());
+        return std::chrono::nanoseconds(*nth);
+    };
+    result.p50 = at(500);
+    result.p90 = at(900);
+    result.p99 = at(990);
+    result.max = at(1000);
+    return result;
+}
+
+SigningService::Metrics SigningService::metrics() const {
+    auto result = Metrics();
+    std::array<std::vector<int64_t>, stageCount> merged;
+    for (auto& worker : workers) {
+        std::lock_guard<std::mutex> lock(worker->statsMutex);
+        result.completed += worker->completed;
+        result.failed += worker->failed;
+        result.resyncs += worker->resyncs;
+        result.stolen += worker->stolen;
+        for (size_t stage = 0; stage < stageCount; stage += 1) {
+            auto& values = worker->samples[stage].values;
+            merged[stage].insert(merged[stage].end(), values.begin(), values.end());
+        }
+    }
+    result.queue = percentiles(merged[queueStage]);
+    result.signing = percentiles(merged[signingStage]);
+    result.total = percentiles(merged[totalStage]);
+    return result;
+}
@@ -0,0 +1,153 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include "dex.pb.h"
+#include "AccountRegistry.h"
+#include "Data.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Binance {
+
+/// Signs orders for many accounts on a pool of worker threads.
+///
+/// Each order is signed as its own transaction. The sequence number is reserved from the account when the order is
+/// submitted, so transactions for an account are numbered in submission order. Orders for an account are queued on
+/// the same worker, which keeps the account in that worker's CPU cache; idle workers steal from busy ones. Signers
+/// take the public key the account derived once. Workers hold no signing state of their own: `Signer::build()` hashes
+/// on the stack, writes into a fresh allocation and draws random blinding from a per-thread buffer in
+/// `crypto/rand.cpp`, so signing shares nothing with other workers beyond the account.
+class SigningService {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Outcome of signing an order.
+    enum class Status {
+        /// The transaction was signed.
+        success,
+
+        /// The order could not be signed and its sequence number was released.
+        failed,
+
+        /// The order could not be signed and later sequence numbers were already reserved, so the account is marked
+        /// for resync and its later transactions will be rejected until it is resynced.
+        resyncRequired,
+    };
+
+    /// Receives a signed transaction, empty if signing failed.
+    ///
+    /// Callbacks run on a worker thread and must not throw.
+    using Callback = std::function<void(Data transaction, Status status)>;
+
+    /// Latency percentiles of one processing stage.
+    struct Percentiles {
+        std::chrono::nanoseconds p50{0};
+        std::chrono::nanoseconds p90{0};
+        std::chrono::nanoseconds p99{0};
+        std::chrono::nanoseconds max{0};
+    };
+
+    /// Service statistics, percentiles cover the most recent `sampleCount` orders of each worker.
+    struct Metrics {
+        /// Number of transactions signed.
+        uint64_t completed = 0;
+
+        /// Number of orders that failed to sign.
+        uint64_t failed = 0;
+
+        /// Number of failed orders whose sequence number could not be released, each marks its account for resync.
+        uint64_t resyncs = 0;
+
+        /// Number of orders taken from another worker's queue.
+        uint64_t stolen = 0;
+
+        /// Time from submission until a worker picks up the order.
+        Percentiles queue;
+
+        /// Time spent building and signing the transaction.
+        Percentiles signing;
+
+        /// Time from submission until the transaction is handed to the caller.
+        Percentiles total;
+    };
+
+    /// Number of latency samples kept per worker and stage.
+    static constexpr size_t sampleCount = 4096;
+
+    /// Chain identifier.
+    const std::string chainId;
+
+    /// Accounts orders can be submitted for.
+    AccountRegistry& accounts;
+
+    /// Initializes a service and starts its workers.
+    ///
+    /// \param threads number of workers, zero to use one per core.
+    SigningService(AccountRegistry& accounts, const std::string& chainId = "chain-bnb", size_t threads = 0);
+
+    /// Signs all pending orders and stops the workers.
+    ~SigningService();
+
+    SigningService(const SigningService&) = delete;
+    SigningService& operator=(const SigningService&) = delete;
+
+    /// Number of worker threads.
+    size_t threads() const { return workers.size(); }
+
+    /// Queues an order.
+    ///
+    /// \returns a future for the signed transaction, empty if signing failed. Check `Account::needsResync()` after a
+    /// failure to find out whether the account's later transactions are affected.
+    /// \throws std::invalid_argument if the account is not registered.
+    std::future<Data> submit(const std::string& name, const ::google::protobuf::Message& order);
+
+    /// Queues an order, the callback receives the signed transaction.
+    ///
+    /// \throws std::invalid_argument if the account is not registered.
+    void submit(const std::string& name, const ::google::protobuf::Message& order, Callback callback);
+
+    /// Returns a snapshot of the service statistics.
+    Metrics metrics() const;
+
+private:
+    struct Job {
+        std::shared_ptr<Account> account;
+        int64_t sequence;
+        std::unique_ptr<::google::protobuf::Message> order;
+        Callback callback;
+        Clock::time_point time;
+    };
+
+    struct Worker;
+
+    bool take(size_t index, Job& job);
+    void run(size_t index);
+    void process(Worker& worker, Job& job);
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> pool;
+
+    // Number of queued orders, incremented under `mutex` so idle workers don't miss a submission.
+    std::atomic<int64_t> pending{0};
+    bool stopping = false;
+    std::mutex mutex;
+    std::condition_variable condition;
+};
+
+} // namespace
@@ -0,0 +1,68 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include "Data.h"
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace Binance {
+
+/// Non-owning view of a contiguous sequence of objects.
+///
+/// The viewed storage must outlive the span.
+template <typename T>
+class Span {
+public:
+    using element_type = T;
+    using value_type = typename std::remove_cv<T>::type;
+    using iterator = T*;
+
+    /// Initializes an empty span.
+    constexpr Span() noexcept : first(nullptr), count(0) {}
+
+    /// Initializes a span over `size` objects starting at `data`.
+    constexpr Span(T* data, size_t size) noexcept : first(data), count(size) {}
+
+    /// Initializes a span over the contents of a contiguous container such as `Data` or `std::string`.
+    template <typename Container, typename = typename std::enable_if<
+        std::is_convertible<decltype(std::declval<Container&>().data()), T*>::value>::type>
+    Span(Container& container) noexcept : first(container.data()), count(container.size()) {}
+
+    constexpr T* data() const noexcept { return first; }
+    constexpr size_t size() const noexcept { return count; }
+    constexpr bool empty() const noexcept { return count == 0; }
+    constexpr iterator begin() const noexcept { return first; }
+    constexpr iterator end() const noexcept { return first + count; }
+    constexpr T& operator[](size_t index) const noexcept { return first[index]; }
+
+    /// Returns a view of `size` objects starting at `offset`, the caller must keep it within bounds.
+    constexpr Span subspan(size_t offset, size_t size) const noexcept { return Span(first + offset, size); }
+
+    /// Returns a view of the objects from `offset` to the end.
+    constexpr Span subspan(size_t offset) const noexcept { return Span(first + offset, count - offset); }
+
+private:
+    T* first;
+    size_t count;
+};
+
+/// View of binary data.
+using ByteSpan = Span<const byte>;
+
+/// View of UTF-8 text.
+using StringSpan = Span<const char>;
+
+/// Copies viewed text into a string.
+inline std::string to_string(StringSpan text) {
+    return std::string(text.data(), text.size());
+}
+
+} // namespace
@@ -0,0 +1,106 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "TransactionBuilder.h"
+#include "Amino.h"
+#include "Decoder.h"
+#include "Instrumentation.h"
+#include "Verifier.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/secp256k1.h"
+#include "crypto/sha2.h"
+
+using namespace Binance;
+
+bool TransactionBuilder::add(const ::google::protobuf::Message& order) {
+    if (messages.size() >= maxMessages) {
+        return false;
+    }
+
+    auto encoded = Amino::encodeOrder(order);
+    if (encoded.empty()) {
+        return false;
+    }
+
+    const auto size = Amino::fieldSize(encoded.size());
+    const auto signatureSize = Amino::signatureEncodedSize(accountNumber, sequence);
+    if (Amino::transactionEncodedSize(messagesSize + size, signatureSize, memo, source) > maxSize) {
+        return false;
+    }
+
+    messages.push_back(&order);
+    encodedMessages.push_back(std::move(encoded));
+    messagesSize += size;
+    return true;
+}
+
+void TransactionBuilder::clear() {
+    messages.clear();
+    encodedMessages.clear();
+    messagesSize = 0;
+}
+
+size_t TransactionBuilder::encodedSize() const {
+    const auto signatureSize = Amino::signatureEncodedSize(accountNumber, sequence);
+    return Amino::transactionEncodedSize(messagesSize, signatureSize, memo, source);
+}
+
+Data TransactionBuilder::build() const {
+    BINANCE_INSTRUMENT(build);
+    const auto signature = sign();
+    if (signature.isZero()) {
+        return {};
+    }
+
+    PublicKey publicKey;
+    {
+        BINANCE_INSTRUMENT(publicKey);
+        ecdsa_get_public_key33(&secp256k1, privateKey.data(), publicKey.data());
+    }
+
+    BINANCE_INSTRUMENT(encode);
+    auto encoded = Amino::encodeSignature(publicKey, signature, accountNumber, sequence);
+    return Amino::encodeTransaction(encodedMessages, encoded, memo, source);
+}
+
+Signature64 TransactionBuilder::sign() const {
+    if (messages.empty()) {
+        return {};
+    }
+
+    // The preimage is streamed from the orders as encoded by `add`, so it always matches the signed messages.
+    auto msgs = Data(messagesSize);
+    auto out = msgs.data();
+    for (const auto& encoded : encodedMessages) {
+        out = Amino::writeField(out, 1, encoded);
+    }
+    Amino::TransactionView view;
+    view.msgs = Amino::RepeatedView<Amino::MessageView>(msgs, 1, encodedMessages.size());
+    view.memo = StringSpan(memo);
+    view.source = source;
+    Amino::SignatureView signatureView;
+    signatureView.accountNumber = accountNumber;
+    signatureView.sequence = sequence;
+
+    byte hash[SHA256_DIGEST_LENGTH];
+    if (!preimageDigest(view, signatureView, chainId, hash)) {
+        return {};
+    }
+
+    Signature64 signature;
+    int result;
+    {
+        BINANCE_INSTRUMENT(sign);
+        result = ecdsa_sign_digest(&secp256k1, privateKey.data(), hash, signature.data(), nullptr, nullptr);
+    }
+    if (-1 == result) {
+        return {};
+    }
+
+    return signature;
+}
@@ -0,0 +1,96 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include "dex.pb.h"
+#include "Data.h"
+#include "FixedData.h"
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace Binance {
+
+/// Builds a transaction carrying several orders under a single signature.
+///
+/// All orders share one sequence number, one signature preimage and one ECDSA signature. Orders are encoded when they
+/// are added and the transaction is signed from that encoding, so changing an order after `add` does not change the
+/// transaction. The orders are also referenced for `orders`, and must outlive the builder if that is used.
+class TransactionBuilder {
+public:
+    /// Default maximum number of messages per transaction.
+    static constexpr size_t defaultMaxMessages = 128;
+
+    /// Default maximum encoded transaction size in bytes.
+    static constexpr size_t defaultMaxSize = 1024 * 1024;
+
+    /// Chain identifier.
+    std::string chainId;
+
+    /// Signer's account number.
+    int64_t accountNumber;
+
+    /// Sequence number for the next transaction.
+    int64_t sequence;
+
+    /// Source identifier, set to zero if unwilling to disclose.
+    int64_t source;
+
+    /// A short remark on the transaction.
+    std::string memo;
+
+    /// Private signing key.
+    PrivateKey privateKey;
+
+    /// Maximum number of messages accepted by `add`.
+    size_t maxMessages;
+
+    /// Maximum encoded transaction size accepted by `add`, including the length prefix.
+    size_t maxSize;
+
+    /// Initializes an empty transaction builder.
+    TransactionBuilder() : chainId("chain-bnb"), accountNumber(), sequence(), source(), memo(), privateKey(), maxMessages(defaultMaxMessages), maxSize(defaultMaxSize) {}
+
+    /// Appends an order to the transaction.
+    ///
+    /// \returns `false` if the order type is not supported or the order would exceed `maxMessages` or `maxSize`.
+    bool add(const ::google::protobuf::Message& order);
+
+    /// Removes all orders so the builder can be reused.
+    void clear();
+
+    /// Orders in the transaction, in signing order.
+    const std::vector<const ::google::protobuf::Message*>& orders() const { return messages; }
+
+    /// Number of orders in the transaction.
+    size_t count() const { return messages.size(); }
+
+    /// Whether the transaction has no orders.
+    bool empty() const { return messages.empty(); }
+
+    /// Exact size of the signed transaction `build` would return.
+    size_t encodedSize() const;
+
+    /// Builds the signed transaction.
+    ///
+    /// \returns the signed transaction data or an empty vector if there are no orders or there is an error.
+    Data build() const;
+
+    /// Signs the transaction.
+    ///
+    /// \returns the transaction signature, all zero if there are no orders or there is an error.
+    Signature64 sign() const;
+
+private:
+    std::vector<const ::google::protobuf::Message*> messages;
+    std::vector<Data> encodedMessages;
+    size_t messagesSize = 0;
+};
+
+} // namespace
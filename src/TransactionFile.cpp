@@ -0,0 +1,167 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "TransactionFile.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <system_error>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace Binance;
+
+MappedFile::MappedFile(const std::string& path) {
+    const auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), path);
+    }
+    struct stat status;
+    if (::fstat(fd, &status) != 0) {
+        const auto error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), path);
+    }
+    size = static_cast<size_t>(status.st_size);
+    if (size == 0) {
+        ::close(fd);
+        return;
+    }
+
+    address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    const auto error = errno;
+    ::close(fd);
+    if (address == MAP_FAILED) {
+        address = nullptr;
+        size = 0;
+        throw std::system_error(error, std::generic_category(), path);
+    }
+
+    // Hints only, failures are harmless.
+    ::madvise(address, size, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+    ::madvise(address, size, MADV_HUGEPAGE);
+#endif
+}
+
+MappedFile::~MappedFile() {
+    if (address != nullptr) {
+        ::munmap(address, size);
+    }
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept : address(other.address), size(other.size) {
+    other.address = nullptr;
+    other.size = 0;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    std::swap(address, other.address);
+    std::swap(size, other.size);
+    return *this;
+}
+
+bool FrameReader::next(ByteSpan& frame) {
+    if (remaining.empty()) {
+        return false;
+    }
+    auto reader = Amino::WireReader(remaining);
+    uint64_t length;
+    if (!reader.readVarint(length)) {
+        error = true;
+        return false;
+    }
+    const auto prefixSize = static_cast<size_t>(reader.current() - remaining.data());
+    if (length > remaining.size() - prefixSize) {
+        error = true;
+        return false;
+    }
+    const auto size = prefixSize + static_cast<size_t>(length);
+    frame = remaining.subspan(0, size);
+    remaining = remaining.subspan(size);
+    return true;
+}
+
+std::vector<ByteSpan> TransactionFileReader::split(size_t count) const {
+    const auto all = data();
+    std::vector<ByteSpan> chunks;
+    if (all.empty() || count == 0) {
+        return chunks;
+    }
+
+    auto reader = FrameReader(all);
+    auto start = all.begin();
+    ByteSpan frame;
+    while (chunks.size() + 1 < count && reader.next(frame)) {
+        const auto target = all.size() * (chunks.size() + 1) / count;
+        if (static_cast<size_t>(frame.end() - all.begin()) >= target) {
+            chunks.emplace_back(start, static_cast<size_t>(frame.end() - start));
+            start = frame.end();
+        }
+    }
+    if (start != all.end()) {
+        chunks.emplace_back(start, static_cast<size_t>(all.end() - start));
+    }
+    return chunks;
+}
+
+TransactionFileReader::Stats TransactionFileReader::process(size_t threads, const Visitor& visitor) const {
+    if (threads == 0) {
+        threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    const auto begin = std::chrono::steady_clock::now();
+
+    // More chunks than threads so uneven chunks even out.
+    const auto chunks = split(threads * 4);
+    std::atomic<size_t> next{0};
+    std::atomic<uint64_t> transactions{0};
+    std::atomic<uint64_t> invalid{0};
+    auto work = [&]() {
+        uint64_t valid = 0;
+        uint64_t failed = 0;
+        for (auto index = next++; index < chunks.size(); index = next++) {
+            auto reader = FrameReader(chunks[index]);
+            ByteSpan frame;
+            Amino::TransactionView view;
+            while (reader.next(frame)) {
+                if (Amino::decodeTransaction(frame, view)) {
+                    visitor(view);
+                    valid += 1;
+                } else {
+                    failed += 1;
+                }
+            }
+            if (reader.failed()) {
+                failed += 1;
+            }
+        }
+        transactions += valid;
+        invalid += failed;
+    };
+
+    std::vector<std::thread> pool;
+    for (size_t i = 1; i < std::min(threads, chunks.size()); i += 1) {
+        pool.emplace_back(work);
+    }
+    work();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    auto stats = Stats();
+    stats.transactions = transactions;
+    stats.invalid = invalid;
+    stats.bytes = data().size();
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    return stats;
+}
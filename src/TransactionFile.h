@@ -0,0 +1,103 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include "Decoder.h"
+#include "Span.h"
+
+#include <functional>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace Binance {
+
+/// Read-only memory mapping of a file.
+class MappedFile {
+public:
+    /// Maps a file, hinting the kernel that it will be read sequentially.
+    ///
+    /// \throws std::system_error if the file cannot be opened or mapped.
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// File contents.
+    ByteSpan data() const { return ByteSpan(static_cast<const byte*>(address), size); }
+
+private:
+    void* address = nullptr;
+    size_t size = 0;
+};
+
+/// Iterates over varint length-prefixed frames without copying them.
+class FrameReader {
+public:
+    explicit FrameReader(ByteSpan data) : remaining(data) {}
+
+    /// Reads the next frame, including its length prefix.
+    ///
+    /// \returns `false` at the end of the data or if the next frame is truncated, see `failed()`.
+    bool next(ByteSpan& frame);
+
+    /// Whether reading stopped at a truncated frame.
+    bool failed() const { return error; }
+
+    /// Unread data.
+    ByteSpan rest() const { return remaining; }
+
+private:
+    ByteSpan remaining;
+    bool error = false;
+};
+
+/// Reads a file of length-prefixed transactions, as written by `Signer::build()`.
+class TransactionFileReader {
+public:
+    /// Processing statistics.
+    struct Stats {
+        uint64_t transactions = 0;
+        uint64_t invalid = 0;
+        uint64_t bytes = 0;
+        double seconds = 0;
+
+        double megabytesPerSecond() const { return seconds > 0 ? bytes / 1e6 / seconds : 0; }
+        double transactionsPerSecond() const { return seconds > 0 ? transactions / seconds : 0; }
+    };
+
+    /// Receives each valid transaction, called concurrently from the processing threads.
+    using Visitor = std::function<void(const Amino::TransactionView& transaction)>;
+
+    /// Maps a transaction file.
+    ///
+    /// \throws std::system_error if the file cannot be opened or mapped.
+    explicit TransactionFileReader(const std::string& path) : file(path) {}
+
+    /// File contents.
+    ByteSpan data() const { return file.data(); }
+
+    /// Splits the file at frame boundaries into at most `count` chunks of similar size.
+    ///
+    /// Each chunk holds whole frames and can be read with its own `FrameReader`. Finding the boundaries only reads
+    /// the length prefixes. A truncated frame at the end of the file is left in the last chunk.
+    std::vector<ByteSpan> split(size_t count) const;
+
+    /// Decodes every transaction on `threads` threads, zero to use all cores.
+    ///
+    /// Frames that fail to decode, including a truncated last frame, are counted as invalid.
+    Stats process(size_t threads, const Visitor& visitor) const;
+
+private:
+    MappedFile file;
+};
+
+} // namespace
@@ -0,0 +1,362 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Verifier.h"
+#include "Amino.h"
+#include "Bech32.h"
+#include "Instrumentation.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/secp256k1.h"
+#include "crypto/sha2.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace Binance;
+using namespace Binance::Amino;
+
+namespace {
+
+/// Writes JSON text into a SHA-256 hash, matching the output of `nlohmann::json::dump()`.
+class JSONHasher {
+public:
+    JSONHasher() { sha256_Init(&context); }
+
+    /// Whether everything written so far has a JSON representation.
+    bool valid = true;
+
+    void raw(const char* text, size_t size) {
+        if (size > sizeof(buffer) - used) {
+            flush();
+            if (size > sizeof(buffer)) {
+                sha256_Update(&context, reinterpret_cast<const uint8_t*>(text), size);
+                return;
+            }
+        }
+        std::memcpy(buffer + used, text, size);
+        used += size;
+    }
+
+    template <size_t N>
+    void literal(const char (&text)[N]) { raw(text, N - 1); }
+
+    void put(char c) {
+        if (used == sizeof(buffer)) {
+            flush();
+        }
+        buffer[used++] = static_cast<uint8_t>(c);
+    }
+
+    void integer(int64_t value) {
+        char digits[20];
+        auto magnitude = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+        size_t count = 0;
+        do {
+            digits[count++] = static_cast<char>('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude != 0);
+        if (value < 0) {
+            put('-');
+        }
+        while (count > 0) {
+            put(digits[--count]);
+        }
+    }
+
+    /// Writes an integer as a JSON string, as the preimage does for the account number, sequence and source.
+    void quotedInteger(int64_t value) {
+        put('"');
+        integer(value);
+        put('"');
+    }
+
+    /// Writes a JSON string, escaping like `dump()` and rejecting invalid UTF-8 like it does.
+    void string(const char* text, size_t size) {
+        static const char hexDigits[] = "0123456789abcdef";
+        put('"');
+        const auto bytes = reinterpret_cast<const uint8_t*>(text);
+        for (size_t i = 0; i < size;) {
+            const auto c = bytes[i];
+            if (c >= 0x80) {
+                const auto length = sequenceLength(bytes + i, size - i);
+                if (length == 0) {
+                    valid = false;
+                    return;
+                }
+                raw(text + i, length);
+                i += length;
+                continue;
+            }
+            switch (c) {
+            case '\b': literal("\\b"); break;
+            case '\t': literal("\\t"); break;
+            case '\n': literal("\\n"); break;
+            case '\f': literal("\\f"); break;
+            case '\r': literal("\\r"); break;
+            case '"': literal("\\\""); break;
+            case '\\': literal("\\\\"); break;
+            default:
+                if (c <= 0x1F) {
+                    const char escaped[] = { '\\', 'u', '0', '0', hexDigits[c >> 4], hexDigits[c & 0xF] };
+                    raw(escaped, sizeof(escaped));
+                } else {
+                    put(static_cast<char>(c));
+                }
+            }
+            i += 1;
+        }
+        put('"');
+    }
+
+    void string(StringSpan text) { string(text.data(), text.size()); }
+
+    void string(const std::string& text) { string(text.data(), text.size()); }
+
+    /// Writes raw bytes as a JSON string, as the preimage does for cancel order senders.
+    void string(ByteSpan bytes) { string(reinterpret_cast<const char*>(bytes.data()), bytes.size()); }
+
+    /// Writes a key hash as a quoted Bech32 address, empty if `Address::encode` would fail.
+    void address(ByteSpan keyHash) {
+        put('"');
+        if (keyHash.size() >= 2 && keyHash.size() <= 40) {
+            static const char hrp[] = "bnb";
+            char encoded[Bech32::encodedSize(sizeof(hrp) - 1, 40)];
+            raw(encoded, Bech32::encode(hrp, sizeof(hrp) - 1, keyHash.data(), keyHash.size(), encoded));
+        }
+        put('"');
+    }
+
+    void finish(uint8_t digest[SHA256_DIGEST_LENGTH]) {
+        flush();
+        sha256_Final(&context, digest);
+    }
+
+private:
+    void flush() {
+        sha256_Update(&context, buffer, used);
+        used = 0;
+    }
+
+    /// Returns the length of the well-formed UTF-8 sequence at `bytes`, or zero.
+    static size_t sequenceLength(const uint8_t* bytes, size_t size) {
+        const auto c = bytes[0];
+        size_t length;
+        uint8_t low = 0x80;
+        uint8_t high = 0xBF;
+        if (c >= 0xC2 && c <= 0xDF) {
+            length = 2;
+        } else if (c >= 0xE0 && c <= 0xEF) {
+            length = 3;
+            if (c == 0xE0) low = 0xA0;
+            if (c == 0xED) high = 0x9F;
+        } else if (c >= 0xF0 && c <= 0xF4) {
+            length = 4;
+            if (c == 0xF0) low = 0x90;
+            if (c == 0xF4) high = 0x8F;
+        } else {
+            return 0;
+        }
+        if (size < length || bytes[1] < low || bytes[1] > high) {
+            return 0;
+        }
+        for (size_t i = 2; i < length; i += 1) {
+            if (bytes[i] < 0x80 || bytes[i] > 0xBF) {
+                return 0;
+            }
+        }
+        return length;
+    }
+
+    SHA256_CTX context;
+    uint8_t buffer[512];
+    size_t used = 0;
+};
+
+void writeCoins(JSONHasher& hasher, const RepeatedView<TokenView>& coins) {
+    hasher.put('[');
+    auto first = true;
+    for (const auto& token : coins) {
+        if (!first) {
+            hasher.put(',');
+        }
+        hasher.literal("{\"amount\":");
+        hasher.integer(token.amount);
+        hasher.literal(",\"denom\":");
+        hasher.string(token.denom);
+        hasher.put('}');
+        first = false;
+    }
+    hasher.put(']');
+}
+
+void writeEntries(JSONHasher& hasher, const RepeatedView<SendEntryView>& entries) {
+    hasher.put('[');
+    auto first = true;
+    for (const auto& entry : entries) {
+        if (!first) {
+            hasher.put(',');
+        }
+        hasher.literal("{\"address\":");
+        hasher.address(entry.address);
+        hasher.literal(",\"coins\":");
+        writeCoins(hasher, entry.coins);
+        hasher.put('}');
+        first = false;
+    }
+    hasher.put(']');
+}
+
+/// Writes an order the way `orderJSON` builds it, keys in sorted order.
+void writeOrder(JSONHasher& hasher, const MessageView& message) {
+    switch (message.type) {
+    case MessageView::Type::newOrder: {
+        NewOrderView order;
+        NewOrderView::decode(message.body, order);
+        hasher.literal("{\"id\":");
+        hasher.string(order.id);
+        // The order type is always serialized as a limit order.
+        hasher.literal(",\"ordertype\":2,\"price\":");
+        hasher.integer(order.price);
+        hasher.literal(",\"quantity\":");
+        hasher.integer(order.quantity);
+        hasher.literal(",\"sender\":");
+        hasher.address(order.sender);
+        hasher.literal(",\"side\":");
+        hasher.integer(order.side);
+        hasher.literal(",\"symbol\":");
+        hasher.string(order.symbol);
+        hasher.literal(",\"timeinforce\":");
+        hasher.integer(order.timeinforce);
+        hasher.put('}');
+        break;
+    }
+    case MessageView::Type::cancelOrder: {
+        CancelOrderView order;
+        CancelOrderView::decode(message.body, order);
+        hasher.literal("{\"refid\":");
+        hasher.string(order.refid);
+        hasher.literal(",\"sender\":");
+        hasher.string(order.sender);
+        hasher.literal(",\"symbol\":");
+        hasher.string(order.symbol);
+        hasher.put('}');
+        break;
+    }
+    case MessageView::Type::send: {
+        SendView order;
+        SendView::decode(message.body, order);
+        hasher.literal("{\"inputs\":");
+        writeEntries(hasher, order.inputs);
+        hasher.literal(",\"outputs\":");
+        writeEntries(hasher, order.outputs);
+        hasher.put('}');
+        break;
+    }
+    case MessageView::Type::tokenFreeze:
+    case MessageView::Type::tokenUnfreeze: {
+        TokenFreezeView order;
+        TokenFreezeView::decode(message.body, order);
+        hasher.literal("{\"amount\":");
+        hasher.integer(order.amount);
+        hasher.literal(",\"from\":");
+        hasher.address(order.from);
+        hasher.literal(",\"symbol\":");
+        hasher.string(order.symbol);
+        hasher.put('}');
+        break;
+    }
+    }
+}
+
+} // namespace
+
+bool Binance::preimageDigest(const TransactionView& transaction, const SignatureView& signature, const std::string& chainId, uint8_t digest[32]) {
+    BINANCE_INSTRUMENT(preimage);
+    auto hasher = JSONHasher();
+    hasher.literal("{\"account_number\":");
+    hasher.quotedInteger(signature.accountNumber);
+    hasher.literal(",\"chain_id\":");
+    hasher.string(chainId);
+    hasher.literal(",\"data\":null,\"memo\":");
+    hasher.string(transaction.memo);
+    hasher.literal(",\"msgs\":[");
+    auto first = true;
+    for (const auto& message : transaction.msgs) {
+        if (!first) {
+            hasher.put(',');
+        }
+        writeOrder(hasher, message);
+        first = false;
+    }
+    hasher.literal("],\"sequence\":");
+    hasher.quotedInteger(signature.sequence);
+    hasher.literal(",\"source\":");
+    hasher.quotedInteger(transaction.source);
+    hasher.put('}');
+    hasher.finish(digest);
+    return hasher.valid;
+}
+
+bool Binance::verifyTransaction(const uint8_t* data, size_t size, const std::string& chainId, SignatureCache* cache, PublicKeyCache* keys) {
+    TransactionView transaction;
+    // Bytes after the length-prefixed frame are not covered by the signatures, so they are rejected.
+    if (!decodeTransaction(ByteSpan(data, size), transaction) || transaction.encoded.size() != size || transaction.signatures.empty()) {
+        return false;
+    }
+    for (const auto& signature : transaction.signatures) {
+        if (signature.publicKey.size() != Amino::publicKeySize || signature.signature.size() != Amino::signatureSize) {
+            return false;
+        }
+        uint8_t digest[SHA256_DIGEST_LENGTH];
+        if (!preimageDigest(transaction, signature, chainId, digest)) {
+            return false;
+        }
+        const auto publicKey = signature.publicKey.data();
+        if (cache != nullptr && cache->contains(publicKey, signature.signature.data(), digest)) {
+            continue;
+        }
+        bool valid;
+        {
+            BINANCE_INSTRUMENT(verify);
+            if (keys != nullptr) {
+                valid = keys->verify(publicKey, signature.signature.data(), digest);
+            } else {
+                valid = ecdsa_verify_digest(&secp256k1, publicKey, signature.signature.data(), digest) == 0;
+            }
+        }
+        if (!valid) {
+            return false;
+        }
+        if (cache != nullptr) {
+            cache->insert(publicKey, signature.signature.data(), digest);
+        }
+    }
+    return true;
+}
+
+size_t Binance::verifyTransactions(const ByteSpan* transactions, size_t count, bool* results, const std::string& chainId, size_t threads,
+    SignatureCache* cache, PublicKeyCache* keys) {
+    auto work = [&](size_t begin, size_t end) {
+        for (auto i = begin; i < end; i += 1) {
+            results[i] = verifyTransaction(transactions[i].data(), transactions[i].size(), chainId, cache, keys);
+        }
+    };
+
+    threads = std::max<size_t>(std::min(threads, count), 1);
+    std::vector<std::thread> pool;
+    for (size_t i = 1; i < threads; i += 1) {
+        pool.emplace_back(work, count * i / threads, count * (i + 1) / threads);
+    }
+    work(0, count / threads);
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    return static_cast<size_t>(std::count(results, results + count, true));
+}
@@ -0,0 +1,49 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include "Decoder.h"
+#include "PublicKeyCache.h"
+#include "SignatureCache.h"
+#include "Span.h"
+
+#include <stdint.h>
+#include <string>
+
+namespace Binance {
+
+/// Computes the SHA-256 digest of the signature preimage of a decoded transaction.
+///
+/// The preimage is written straight into the hash, byte for byte as `signaturePreimage` produces it for the orders
+/// in the transaction and the account number and sequence of `signature`.
+///
+/// \returns `false` if no preimage exists for the transaction, for instance because a text field is not valid UTF-8.
+bool preimageDigest(const Amino::TransactionView& transaction, const Amino::SignatureView& signature, const std::string& chainId, uint8_t digest[32]);
+
+/// Verifies a length-prefixed transaction as produced by `Signer::build()`.
+///
+/// The transaction is decoded, and every signature is checked against its public key and the preimage rebuilt from
+/// the decoded orders. Does not allocate unless `cache` or `keys` is passed.
+///
+/// \param cache if not null, signatures verified before are looked up instead of checked again.
+/// \param keys if not null, public keys are decompressed through this cache.
+/// \returns `false` if the transaction is malformed, is followed by other data, has no signature or any signature is
+/// invalid.
+bool verifyTransaction(const uint8_t* data, size_t size, const std::string& chainId = "chain-bnb", SignatureCache* cache = nullptr,
+    PublicKeyCache* keys = nullptr);
+
+/// Verifies a batch of transactions, splitting the batch over `threads` threads.
+///
+/// \param results receives the outcome for each transaction.
+/// \param cache optional signature cache shared by all threads.
+/// \param keys optional public key cache shared by all threads.
+/// \returns the number of valid transactions.
+size_t verifyTransactions(const ByteSpan* transactions, size_t count, bool* results, const std::string& chainId = "chain-bnb", size_t threads = 1,
+    SignatureCache* cache = nullptr, PublicKeyCache* keys = nullptr);
+
+} // namespace
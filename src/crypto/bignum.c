@@ -590,6 +590,38 @@ void bn_inverse(bignum256 *x, const bignum256 *prime)
 	memcpy(x, &res, sizeof(bignum256));
 }
 
+// inverts count numbers with a single inversion (Montgomery's trick)
+// zero elements are left as zero
+// scratch must hold count numbers
+void bn_batch_inverse(bignum256 *x, size_t count, const bignum256 *prime, bignum256 *scratch)
+{
+	size_t i;
+	bignum256 acc, inv;
+	bn_one(&acc);
+	for (i = 0; i < count; i++) {
+		bn_mod(&x[i], prime);
+		// scratch[i] = product of the non-zero x[0..i-1]
+		memcpy(&scratch[i], &acc, sizeof(bignum256));
+		if (!bn_is_zero(&x[i])) {
+			bn_multiply(&x[i], &acc, prime);
+		}
+	}
+	bn_inverse(&acc, prime);
+	// acc = inverse of the product of the non-zero x[0..count-1]
+	for (i = count; i-- > 0;) {
+		if (bn_is_zero(&x[i])) {
+			continue;
+		}
+		memcpy(&inv, &scratch[i], sizeof(bignum256));
+		bn_multiply(&acc, &inv, prime);
+		bn_multiply(&x[i], &acc, prime);
+		bn_mod(&inv, prime);
+		memcpy(&x[i], &inv, sizeof(bignum256));
+	}
+	memzero(&acc, sizeof(acc));
+	memzero(&inv, sizeof(inv));
+}
+
 void bn_normalize(bignum256 *a) {
 	bn_addi(a, 0);
 }
@@ -134,6 +134,8 @@ void bn_sqrt(bignum256 *x, const bignum256 *prime);
 
 void bn_inverse(bignum256 *x, const bignum256 *prime);
 
+void bn_batch_inverse(bignum256 *x, size_t count, const bignum256 *prime, bignum256 *scratch);
+
 void bn_normalize(bignum256 *a);
 
 void bn_add(bignum256 *a, const bignum256 *b);
@@ -0,0 +1,213 @@
+/**
+ * Copyright (c) 2013-2014 Tomas Dzetkulic
+ * Copyright (c) 2013-2014 Pavol Rusnak
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "bignum.h"
+#include "bip32.h"
+#include "ecdsa.h"
+#include "hmac.h"
+#include "memzero.h"
+#include "secp256k1.h"
+#include "sha2.h"
+
+int hdnode_from_seed(const uint8_t *seed, size_t seed_len, HDNode *out)
+{
+	uint8_t I[32 + 32];
+	bignum256 a;
+	int ok = seed_len >= 16 && seed_len <= 64;
+	memzero(out, sizeof(HDNode));
+	if (ok) {
+		hmac_sha512((const uint8_t *)secp256k1_info.bip32_name, strlen(secp256k1_info.bip32_name), seed, seed_len, I);
+		bn_read_be(I, &a);
+		ok = !bn_is_zero(&a) && bn_is_less(&a, &secp256k1.order);
+	}
+	if (ok) {
+		memcpy(out->private_key, I, 32);
+		memcpy(out->chain_code, I + 32, 32);
+	}
+	memzero(&a, sizeof(a));
+	memzero(I, sizeof(I));
+	return ok;
+}
+
+int hdnode_private_ckd(HDNode *inout, uint32_t i)
+{
+	uint8_t data[1 + 32 + 4];
+	uint8_t I[32 + 32];
+	bignum256 a, b;
+
+	if (i & BIP32_HARDENED) {
+		data[0] = 0;
+		memcpy(data + 1, inout->private_key, 32);
+	} else {
+		hdnode_fill_public_key(inout);
+		memcpy(data, inout->public_key, 33);
+	}
+	data[33] = i >> 24;
+	data[34] = i >> 16;
+	data[35] = i >> 8;
+	data[36] = i;
+
+	hmac_sha512(inout->chain_code, 32, data, sizeof(data), I);
+	bn_read_be(inout->private_key, &a);
+	bn_read_be(I, &b);
+	int ok = bn_is_less(&b, &secp256k1.order);
+	if (ok) {
+		bn_addmod(&a, &b, &secp256k1.order);
+		bn_mod(&a, &secp256k1.order);
+		ok = !bn_is_zero(&a);
+	}
+
+	if (ok) {
+		inout->depth++;
+		inout->child_num = i;
+		memcpy(inout->chain_code, I + 32, 32);
+		bn_write_be(&a, inout->private_key);
+		inout->public_key[0] = 0;
+	} else {
+		memzero(inout, sizeof(HDNode));
+	}
+	memzero(data, sizeof(data));
+	memzero(I, sizeof(I));
+	memzero(&a, sizeof(a));
+	memzero(&b, sizeof(b));
+	return ok;
+}
+
+void hdnode_fill_public_key(HDNode *node)
+{
+	if (node->public_key[0] == 0) {
+		ecdsa_get_public_key33(&secp256k1, node->private_key, node->public_key);
+	}
+}
+
+int hdnode_public_ckd(HDNode *inout, uint32_t i)
+{
+	uint8_t data[33 + 4];
+	uint8_t I[32 + 32];
+	bignum256 tweak;
+	curve_point parent, child;
+
+	int ok = !(i & BIP32_HARDENED) && ecdsa_read_pubkey(&secp256k1, inout->public_key, &parent);
+	if (ok) {
+		memcpy(data, inout->public_key, 33);
+		data[33] = i >> 24;
+		data[34] = i >> 16;
+		data[35] = i >> 8;
+		data[36] = i;
+		hmac_sha512(inout->chain_code, 32, data, sizeof(data), I);
+		bn_read_be(I, &tweak);
+		ok = bn_is_less(&tweak, &secp256k1.order);
+	}
+	if (ok) {
+		scalar_multiply(&secp256k1, &tweak, &child);
+		point_add(&secp256k1, &parent, &child);
+		ok = !point_is_infinity(&child);
+	}
+
+	if (ok) {
+		inout->depth++;
+		inout->child_num = i;
+		memcpy(inout->chain_code, I + 32, 32);
+		memzero(inout->private_key, 32);
+		inout->public_key[0] = 0x02 | (child.y.val[0] & 0x01);
+		bn_write_be(&child.x, inout->public_key + 1);
+	} else {
+		memzero(inout, sizeof(HDNode));
+	}
+	memzero(I, sizeof(I));
+	return ok;
+}
+
+// Number of children sharing a field inversion.
+#define BIP32_BATCH_SIZE 64
+
+size_t hdnode_public_ckd_batch(const HDNode *parent, uint32_t first, size_t count, uint8_t *public_keys, int *results)
+{
+	curve_point pub;
+	uint64_t odig[8], idig[8];
+	uint64_t block[16], outer[16], I[8];
+	uint8_t IL[32];
+	bignum256 tweak;
+	jacobian_curve_point jp[BIP32_BATCH_SIZE];
+	curve_point points[BIP32_BATCH_SIZE];
+	bignum256 scratch[2 * BIP32_BATCH_SIZE];
+	int valid[BIP32_BATCH_SIZE];
+	size_t derived = 0;
+
+	if (!ecdsa_read_pubkey(&secp256k1, parent->public_key, &pub)) {
+		memset(public_keys, 0, 33 * count);
+		for (size_t k = 0; k < count; k++) {
+			results[k] = 1;
+		}
+		return 0;
+	}
+
+	// HMAC-SHA512 keyed with the chain code of the single block pub || ser32(i), from the midstates of its pads.
+	hmac_sha512_prepare(parent->chain_code, 32, odig, idig);
+	memset(block, 0, sizeof(block));
+	for (int k = 0; k < 33; k++) {
+		block[k / 8] |= (uint64_t)parent->public_key[k] << (56 - 8 * (k % 8));
+	}
+	block[15] = (SHA512_BLOCK_LENGTH + 37) * 8;
+	memset(outer, 0, sizeof(outer));
+	outer[8] = 0x8000000000000000;
+	outer[15] = (SHA512_BLOCK_LENGTH + SHA512_DIGEST_LENGTH) * 8;
+	const uint64_t word4 = block[4];
+
+	for (size_t offset = 0; offset < count; offset += BIP32_BATCH_SIZE) {
+		const size_t size = count - offset < BIP32_BATCH_SIZE ? count - offset : BIP32_BATCH_SIZE;
+		for (size_t k = 0; k < size; k++) {
+			const uint32_t i = first + (uint32_t)(offset + k);
+			block[4] = word4 | ((uint64_t)i << 24) | ((uint64_t)0x80 << 16);
+			sha512_Transform(idig, block, outer);
+			sha512_Transform(odig, outer, I);
+			for (int b = 0; b < 32; b++) {
+				IL[b] = I[b / 8] >> (56 - 8 * (b % 8));
+			}
+			bn_read_be(IL, &tweak);
+			valid[k] = !(i & BIP32_HARDENED) && bn_is_less(&tweak, &secp256k1.order);
+			if (!valid[k]) {
+				memset(&jp[k], 0, sizeof(jp[k]));
+			} else if (scalar_multiply_jacobian(&secp256k1, &tweak, &jp[k])) {
+				point_jacobian_add(&pub, &jp[k], &secp256k1);
+			} else {
+				curve_to_jacobian(&pub, &jp[k], &secp256k1.prime);
+			}
+		}
+		jacobian_to_curve_batch(jp, points, size, &secp256k1.prime, scratch);
+		for (size_t k = 0; k < size; k++) {
+			uint8_t *key = public_keys + 33 * (offset + k);
+			results[offset + k] = !valid[k] || point_is_infinity(&points[k]);
+			if (results[offset + k] == 0) {
+				key[0] = 0x02 | (points[k].y.val[0] & 0x01);
+				bn_write_be(&points[k].x, key + 1);
+				derived++;
+			} else {
+				memset(key, 0, 33);
+			}
+		}
+	}
+	return derived;
+}
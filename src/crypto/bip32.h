@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2013-2014 Tomas Dzetkulic
+ * Copyright (c) 2013-2014 Pavol Rusnak
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __BIP32_H__
+#define __BIP32_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Child indices at or above this value derive hardened children.
+#define BIP32_HARDENED 0x80000000u
+
+// Extended private key on secp256k1. A public key whose first byte is zero has not been computed yet.
+typedef struct {
+	uint32_t depth;
+	uint32_t child_num;
+	uint8_t chain_code[32];
+	uint8_t private_key[32];
+	uint8_t public_key[33];
+} HDNode;
+
+// Derives the master node of a 16 to 64 byte seed. Returns 0 if the seed length or the derived key is invalid.
+int hdnode_from_seed(const uint8_t *seed, size_t seed_len, HDNode *out);
+
+// Replaces a node by its child `i`, computing the parent public key first for normal derivation.
+// Returns 0, leaving the node wiped, for the indices BIP32 declares invalid.
+int hdnode_private_ckd(HDNode *inout, uint32_t i);
+
+// Computes the compressed public key of a node unless it is already known.
+void hdnode_fill_public_key(HDNode *node);
+
+// Replaces a node by its normal child `i` using only its public key and chain code, wiping the private key.
+// Returns 0, leaving the node wiped, for hardened or invalid indices.
+int hdnode_public_ckd(HDNode *inout, uint32_t i);
+
+// Derives the compressed public keys of the normal children `first` to `first + count - 1` of a node from its public
+// key and chain code alone, as from an xpub. The public key of the parent must be set. The children are converted to
+// affine coordinates in chunks that share one field inversion.
+// Returns the number of keys derived. Like the other batch functions, `results[k]` is 0 if key k was derived and 1,
+// with the key wiped, for the indices BIP32 declares invalid.
+size_t hdnode_public_ckd_batch(const HDNode *parent, uint32_t first, size_t count, uint8_t *public_keys, int *results);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
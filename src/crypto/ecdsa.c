@@ -36,6 +36,15 @@
 #include "rfc6979.h"
 #include "memzero.h"
 
+// wNAF window used with a precomputed verification context
+#define ECDSA_VERIFY_CTX_WINDOW 8
+#define ECDSA_VERIFY_CTX_SIZE (1 << (ECDSA_VERIFY_CTX_WINDOW - 2))
+
+// odd multiples P, 3P, ..., (2^(ECDSA_VERIFY_CTX_WINDOW-1) - 1) P of a public key, in affine form
+struct ecdsa_verify_ctx {
+	curve_point table[ECDSA_VERIFY_CTX_SIZE];
+};
+
 // Set cp2 = cp1
 void point_copy(const curve_point *cp1, curve_point *cp2)
 {
@@ -186,10 +195,6 @@ void conditional_negate(uint32_t cond, bignum256 *a, const bignum256 *prime)
 	assert(a->val[8] < 0x20000);
 }
 
-typedef struct jacobian_curve_point {
-	bignum256 x, y, z;
-} jacobian_curve_point;
-
 // generate random K for signing/side-channel noise
 static void generate_k_random(bignum256 *k, const bignum256 *prime) {
 	do {
@@ -234,6 +239,34 @@ void jacobian_to_curve(const jacobian_curve_point *jp, curve_point *p, const big
 	bn_mod(&p->y, prime);
 }
 
+// converts count points to affine coordinates with a single inversion,
+// points with z = 0 are set to infinity
+// scratch must hold 2 * count numbers
+void jacobian_to_curve_batch(const jacobian_curve_point *jp, curve_point *p, size_t count, const bignum256 *prime, bignum256 *scratch) {
+	bignum256 *zinv = scratch + count;
+	size_t i;
+	for (i = 0; i < count; i++) {
+		zinv[i] = jp[i].z;
+	}
+	bn_batch_inverse(zinv, count, prime, scratch);
+	for (i = 0; i < count; i++) {
+		if (bn_is_zero(&zinv[i])) {
+			point_set_infinity(&p[i]);
+			continue;
+		}
+		p[i].y = zinv[i];
+		p[i].x = p[i].y;
+		bn_multiply(&p[i].x, &p[i].x, prime);
+		// p->x = z^-2
+		bn_multiply(&p[i].x, &p[i].y, prime);
+		// p->y = z^-3
+		bn_multiply(&jp[i].x, &p[i].x, prime);
+		bn_multiply(&jp[i].y, &p[i].y, prime);
+		bn_mod(&p[i].x, prime);
+		bn_mod(&p[i].y, prime);
+	}
+}
+
 void point_jacobian_add(const curve_point *p1, jacobian_curve_point *p2, const ecdsa_curve *curve) {
 	bignum256 r, h, r2;
 	bignum256 hcby, hsqx;
@@ -421,6 +454,18 @@ void point_jacobian_double(jacobian_curve_point *p, const ecdsa_curve *curve) {
 	bn_fast_mod(&p->y, prime);
 }
 
+// out = table[index], reading every entry so the memory access pattern does not depend on index
+static void point_table_select(const curve_point *table, uint32_t size, uint32_t index, curve_point *out)
+{
+	uint32_t i;
+	for (i = 0; i < size; i++) {
+		// equal = 1 if i == index, 0 otherwise
+		int equal = (int)(((i ^ index) - 1) >> 31);
+		bn_cmov(&out->x, equal, &table[i].x, &out->x);
+		bn_cmov(&out->y, equal, &table[i].y, &out->y);
+	}
+}
+
 // res = k * p
 void point_multiply(const ecdsa_curve *curve, const bignum256 *k, const curve_point *p, curve_point *res)
 {
@@ -438,7 +483,9 @@ void point_multiply(const ecdsa_curve *curve, const bignum256 *k, const curve_po
 	uint32_t is_even = (k->val[0] & 1) - 1;
 	uint32_t bits, sign, nsign;
 	jacobian_curve_point jres;
-	curve_point pmult[8];
+	jacobian_curve_point jmult[8];
+	curve_point pmult[8], p2, odd;
+	bignum256 scratch[16];
 	const bignum256 *prime = &curve->prime;
 
 	// is_even = 0xffffffff if k is even, 0 otherwise.
@@ -477,15 +524,16 @@ void point_multiply(const ecdsa_curve *curve, const bignum256 *k, const curve_po
 	// We compute |a[i]| * p in advance for all possible
 	// values of |a[i]| * p.  pmult[i] = (2*i+1) * p
 	// We compute p, 3*p, ..., 15*p and store it in the table pmult.
-	// store p^2 temporarily in pmult[7]
-	pmult[7] = *p;
-	point_double(curve, &pmult[7]);
-	// compute 3*p, etc by repeatedly adding p^2.
-	pmult[0] = *p;
+	// compute 3*p, etc by repeatedly adding 2*p in jacobian coordinates
+	// and convert them with a single inversion.
+	p2 = *p;
+	point_double(curve, &p2);
+	curve_to_jacobian(p, &jmult[0], prime);
 	for (i = 1; i < 8; i++) {
-		pmult[i] = pmult[7];
-		point_add(curve, &pmult[i-1], &pmult[i]);
+		jmult[i] = jmult[i-1];
+		point_jacobian_add(&p2, &jmult[i], curve);
 	}
+	jacobian_to_curve_batch(jmult, pmult, 8, prime, scratch);
 
 	// now compute  res = sum_{i=0..63} a[i] * 16^i * p step by step,
 	// starting with i = 63.
@@ -501,7 +549,8 @@ void point_multiply(const ecdsa_curve *curve, const bignum256 *k, const curve_po
 	sign = (bits >> 4) - 1;
 	bits ^= sign;
 	bits &= 15;
-	curve_to_jacobian(&pmult[bits>>1], &jres, prime);
+	point_table_select(pmult, 8, bits >> 1, &odd);
+	curve_to_jacobian(&odd, &jres, prime);
 	for (i = 62; i >= 0; i--) {
 		// sign = sign(a[i+1])  (0xffffffff for negative, 0 for positive)
 		// invariant jres = (-1)^sign sum_{j=i+1..63} (a[j] * 16^{j-i-1} * p)
@@ -534,18 +583,20 @@ void point_multiply(const ecdsa_curve *curve, const bignum256 *k, const curve_po
 		conditional_negate(sign ^ nsign, &jres.z, prime);
 
 		// add odd factor
-		point_jacobian_add(&pmult[bits >> 1], &jres, curve);
+		point_table_select(pmult, 8, bits >> 1, &odd);
+		point_jacobian_add(&odd, &jres, curve);
 		sign = nsign;
 	}
 	conditional_negate(sign, &jres.z, prime);
 	jacobian_to_curve(&jres, res, prime);
 	memzero(&a, sizeof(a));
 	memzero(&jres, sizeof(jres));
+	memzero(&odd, sizeof(odd));
 }
 
-// res = k * G
+// jres = k * G in jacobian coordinates, returns 0 for k = 0 which has no jacobian representation
 // k must be a normalized number with 0 <= k < curve->order
-void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k, curve_point *res)
+int scalar_multiply_jacobian(const ecdsa_curve *curve, const bignum256 *k, jacobian_curve_point *jres)
 {
 	assert (bn_is_less(k, &curve->order));
 
@@ -553,7 +604,7 @@ void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k, curve_point *
 	bignum256 a;
 	uint32_t is_even = (k->val[0] & 1) - 1;
 	uint32_t lowbits;
-	jacobian_curve_point jres;
+	curve_point odd;
 	const bignum256 *prime = &curve->prime;
 
 	// is_even = 0xffffffff if k is even, 0 otherwise.
@@ -574,8 +625,7 @@ void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k, curve_point *
 
 	// special case 0*G:  just return zero. We don't care about constant time.
 	if (!is_non_zero) {
-		point_set_infinity(res);
-		return;
+		return 0;
 	}
 
 	// Now a = k + 2^256 (mod curve->order) and a is odd.
@@ -601,7 +651,8 @@ void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k, curve_point *
 	lowbits = a.val[0] & ((1 << 5) - 1);
 	lowbits ^= (lowbits >> 4) - 1;
 	lowbits &= 15;
-	curve_to_jacobian(&curve->cp[0][lowbits >> 1], &jres, prime);
+	point_table_select(curve->cp[0], 8, lowbits >> 1, &odd);
+	curve_to_jacobian(&odd, jres, prime);
 	for (i = 1; i < 64; i ++) {
 		// invariant res = sign(a[i-1]) sum_{j=0..i-1} (a[j] * 16^j * G)
 
@@ -618,26 +669,47 @@ void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k, curve_point *
 		lowbits &= 15;
 		// negate last result to make signs of this round and the
 		// last round equal.
-		conditional_negate((lowbits & 1) - 1, &jres.y, prime);
+		conditional_negate((lowbits & 1) - 1, &jres->y, prime);
 
 		// add odd factor
-		point_jacobian_add(&curve->cp[i][lowbits >> 1], &jres, curve);
+		point_table_select(curve->cp[i], 8, lowbits >> 1, &odd);
+		point_jacobian_add(&odd, jres, curve);
 	}
-	conditional_negate(((a.val[0] >> 4) & 1) - 1, &jres.y, prime);
-	jacobian_to_curve(&jres, res, prime);
+	conditional_negate(((a.val[0] >> 4) & 1) - 1, &jres->y, prime);
 	memzero(&a, sizeof(a));
+	memzero(&odd, sizeof(odd));
+	return 1;
+}
+
+// res = k * G
+// k must be a normalized number with 0 <= k < curve->order
+void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k, curve_point *res)
+{
+	jacobian_curve_point jres;
+	if (!scalar_multiply_jacobian(curve, k, &jres)) {
+		point_set_infinity(res);
+		return;
+	}
+	jacobian_to_curve(&jres, res, &curve->prime);
 	memzero(&jres, sizeof(jres));
 }
 
+// reads an ECDH private key, which must be a scalar in [1, order - 1]
+static int ecdh_read_scalar(const ecdsa_curve *curve, const uint8_t *priv_key, bignum256 *k)
+{
+	bn_read_be(priv_key, k);
+	return !bn_is_zero(k) && bn_is_less(k, &curve->order);
+}
+
 int ecdh_multiply(const ecdsa_curve *curve, const uint8_t *priv_key, const uint8_t *pub_key, uint8_t *session_key)
 {
 	curve_point point;
-	if (!ecdsa_read_pubkey(curve, pub_key, &point)) {
+	bignum256 k;
+	if (!ecdh_read_scalar(curve, priv_key, &k) || !ecdsa_read_pubkey(curve, pub_key, &point)) {
+		memzero(&k, sizeof(k));
 		return 1;
 	}
 
-	bignum256 k;
-	bn_read_be(priv_key, &k);
 	point_multiply(curve, &k, &point, &point);
 	memzero(&k, sizeof(k));
 
@@ -649,6 +721,164 @@ int ecdh_multiply(const ecdsa_curve *curve, const uint8_t *priv_key, const uint8
 	return 0;
 }
 
+// swaps a and b if cond is 1, keeps them if cond is 0, in constant time
+static void bn_cswap(int cond, bignum256 *a, bignum256 *b)
+{
+	bignum256 t = *a;
+	bn_cmov(a, cond, b, a);
+	bn_cmov(b, cond, &t, b);
+	memzero(&t, sizeof(t));
+}
+
+// X/Z = x(k * p) with a Montgomery ladder on x-coordinates (Brier and Joye, Weierstrass Elliptic
+// Curves and Side-Channel Attacks), for curves with a = 0.  Every scalar runs the same 256 steps of
+// a differential addition and a doubling, without tables.  x is the affine x-coordinate of p.
+static void point_multiply_x(const ecdsa_curve *curve, const bignum256 *k, const bignum256 *x, bignum256 *X, bignum256 *Z)
+{
+	const bignum256 *prime = &curve->prime;
+	bignum256 x0, z0, x1, z1, t1, t2, t3, t4;
+	int i, bit;
+
+	assert(curve->a == 0);
+
+	// R0 = infinity, R1 = p, and R1 - R0 = p throughout.
+	bn_one(&x0);
+	bn_zero(&z0);
+	x1 = *x;
+	bn_one(&z1);
+	for (i = 255; i >= 0; i--) {
+		bit = (k->val[i / 30] >> (i % 30)) & 1;
+		bn_cswap(bit, &x0, &x1);
+		bn_cswap(bit, &z0, &z1);
+
+		// R1 = R0 + R1:
+		// X = (X0 X1)^2 - 4b Z0 Z1 (X0 Z1 + X1 Z0)
+		// Z = x (X0 Z1 - X1 Z0)^2
+		t1 = x0;
+		bn_multiply(&x1, &t1, prime);
+		t2 = z0;
+		bn_multiply(&z1, &t2, prime);
+		t3 = x0;
+		bn_multiply(&z1, &t3, prime);
+		t4 = x1;
+		bn_multiply(&z0, &t4, prime);
+		bn_subtractmod(&t3, &t4, &z1, prime);
+		bn_multiply(&z1, &z1, prime);
+		bn_multiply(x, &z1, prime);
+		bn_addmod(&t3, &t4, prime);
+		bn_multiply(&t2, &t3, prime);
+		bn_multiply(&curve->b, &t3, prime);
+		bn_mult_k(&t3, 4, prime);
+		bn_multiply(&t1, &t1, prime);
+		bn_subtractmod(&t1, &t3, &x1, prime);
+
+		// R0 = 2 R0:
+		// X = X^4 - 8b X Z^3
+		// Z = 4 Z (X^3 + b Z^3)
+		t1 = x0;
+		bn_multiply(&t1, &t1, prime);
+		t2 = z0;
+		bn_multiply(&t2, &t2, prime);
+		bn_multiply(&z0, &t2, prime);
+		bn_multiply(&curve->b, &t2, prime);
+		t3 = t1;
+		bn_multiply(&x0, &t3, prime);
+		bn_addmod(&t3, &t2, prime);
+		bn_multiply(&x0, &t2, prime);
+		bn_mult_k(&t2, 4, prime);
+		bn_mult_k(&t2, 2, prime);
+		bn_multiply(&t1, &t1, prime);
+		bn_subtractmod(&t1, &t2, &x0, prime);
+		bn_multiply(&t3, &z0, prime);
+		bn_mult_k(&z0, 4, prime);
+
+		bn_cswap(bit, &x0, &x1);
+		bn_cswap(bit, &z0, &z1);
+	}
+	*X = x0;
+	*Z = z0;
+	memzero(&x0, sizeof(x0));
+	memzero(&z0, sizeof(z0));
+	memzero(&x1, sizeof(x1));
+	memzero(&z1, sizeof(z1));
+	memzero(&t1, sizeof(t1));
+	memzero(&t2, sizeof(t2));
+	memzero(&t3, sizeof(t3));
+	memzero(&t4, sizeof(t4));
+}
+
+int ecdh_multiply_x(const ecdsa_curve *curve, const uint8_t *priv_key, const uint8_t *pub_key, uint8_t *session_x)
+{
+	curve_point point;
+	bignum256 k, X, Z;
+	if (!ecdh_read_scalar(curve, priv_key, &k) || !ecdsa_read_pubkey(curve, pub_key, &point)) {
+		memzero(&k, sizeof(k));
+		return 1;
+	}
+
+	point_multiply_x(curve, &k, &point.x, &X, &Z);
+	bn_inverse(&Z, &curve->prime);
+	bn_multiply(&Z, &X, &curve->prime);
+	bn_mod(&X, &curve->prime);
+	bn_write_be(&X, session_x);
+
+	memzero(&k, sizeof(k));
+	memzero(&X, sizeof(X));
+	memzero(&Z, sizeof(Z));
+	return 0;
+}
+
+// Number of shared secrets converted with one inversion.
+#define ECDH_BATCH_SIZE 64
+
+size_t ecdh_multiply_x_batch(const ecdsa_curve *curve, const uint8_t *priv_key, const uint8_t *pub_keys, size_t count, uint8_t *session_xs, int *results)
+{
+	curve_point point;
+	bignum256 k;
+	bignum256 X[ECDH_BATCH_SIZE], Z[ECDH_BATCH_SIZE], scratch[ECDH_BATCH_SIZE];
+	size_t computed = 0;
+
+	if (!ecdh_read_scalar(curve, priv_key, &k)) {
+		memzero(&k, sizeof(k));
+		memset(session_xs, 0, 32 * count);
+		for (size_t i = 0; i < count; i++) {
+			results[i] = 1;
+		}
+		return 0;
+	}
+
+	for (size_t offset = 0; offset < count; offset += ECDH_BATCH_SIZE) {
+		const size_t size = count - offset < ECDH_BATCH_SIZE ? count - offset : ECDH_BATCH_SIZE;
+		for (size_t i = 0; i < size; i++) {
+			if (ecdsa_read_pubkey(curve, pub_keys + 33 * (offset + i), &point)) {
+				point_multiply_x(curve, &k, &point.x, &X[i], &Z[i]);
+			} else {
+				// left as zero by the inversion
+				bn_zero(&Z[i]);
+			}
+		}
+		bn_batch_inverse(Z, size, &curve->prime, scratch);
+		for (size_t i = 0; i < size; i++) {
+			uint8_t *session_x = session_xs + 32 * (offset + i);
+			results[offset + i] = bn_is_zero(&Z[i]);
+			if (results[offset + i] == 0) {
+				bn_multiply(&Z[i], &X[i], &curve->prime);
+				bn_mod(&X[i], &curve->prime);
+				bn_write_be(&X[i], session_x);
+				computed++;
+			} else {
+				memset(session_x, 0, 32);
+			}
+		}
+	}
+
+	memzero(&k, sizeof(k));
+	memzero(X, sizeof(X));
+	memzero(Z, sizeof(Z));
+	memzero(scratch, sizeof(scratch));
+	return computed;
+}
+
 void init_rfc6979(const uint8_t *priv_key, const uint8_t *hash, rfc6979_state *state) {
 	uint8_t bx[2*32];
 	uint8_t buf[32 + 1 + 2*32];
@@ -1011,43 +1241,315 @@ int ecdsa_recover_pub_from_sig (const ecdsa_curve *curve, uint8_t *pub_key, cons
 	return 0;
 }
 
+// number of signatures sharing each batched inversion
+#define RECOVER_BATCH 16
+// width of the wNAF digits, the odd multiples up to 15 P are precomputed
+#define WNAF_WINDOW 5
+// room for the widest window in use
+#define WNAF_SIZE (256 + ECDSA_VERIFY_CTX_WINDOW + 1)
+
+// returns count bits of k starting at bit pos, count <= 30
+static uint32_t bn_get_bits(const bignum256 *k, int pos, int count)
+{
+	int limb = pos / 30;
+	int shift = pos % 30;
+	uint64_t value;
+	if (limb >= 9) {
+		return 0;
+	}
+	value = k->val[limb] >> shift;
+	if (limb + 1 < 9) {
+		value |= (uint64_t)k->val[limb + 1] << (30 - shift);
+	}
+	return value & ((1u << count) - 1);
+}
+
+// computes the width-w NAF of k: k = sum naf[i] 2^i with odd digits |naf[i]| < 2^(w-1)
+// and at least w-1 zeros between non-zero digits
+static void bn_wnaf(const bignum256 *k, int8_t naf[WNAF_SIZE], int w)
+{
+	int i = 0;
+	int carry = 0;
+	memset(naf, 0, WNAF_SIZE);
+	while (i < 256 || carry) {
+		if ((int)bn_get_bits(k, i, 1) == carry) {
+			i++;
+			continue;
+		}
+		int window = bn_get_bits(k, i, w) + carry;
+		carry = window >> (w - 1);
+		naf[i] = window - (carry << w);
+		i += w;
+	}
+}
+
+// adds digit * table[|digit|/2] to res, starting res if it is still empty
+static void point_jacobian_add_digit(const ecdsa_curve *curve, int digit, const curve_point *table, jacobian_curve_point *res, int *started)
+{
+	curve_point neg;
+	const curve_point *p;
+	if (digit == 0) {
+		return;
+	}
+	p = &table[(digit < 0 ? -digit : digit) >> 1];
+	if (digit < 0) {
+		neg.x = p->x;
+		bn_subtract(&curve->prime, &p->y, &neg.y);
+		p = &neg;
+	}
+	if (*started) {
+		point_jacobian_add(p, res, curve);
+	} else {
+		res->x = p->x;
+		res->y = p->y;
+		bn_one(&res->z);
+		*started = 1;
+	}
+}
+
+// res = a * G + b * P, interleaving the doublings of both multiplications
+// table holds the odd multiples P, 3P, ..., (2^(window-1) - 1) P
+// a result at infinity, or passing through infinity, yields z = 0
+static void point_joint_multiply(const ecdsa_curve *curve, const bignum256 *a, const bignum256 *b, const curve_point *table, int window, jacobian_curve_point *res)
+{
+	int8_t naf_a[WNAF_SIZE], naf_b[WNAF_SIZE];
+	int i, started = 0;
+	bn_wnaf(a, naf_a, WNAF_WINDOW);
+	bn_wnaf(b, naf_b, window);
+	for (i = WNAF_SIZE - 1; i >= 0; i--) {
+		if (started) {
+			point_jacobian_double(res, curve);
+		}
+		// curve->cp[0][j] = (2*j+1) * G
+		point_jacobian_add_digit(curve, naf_a[i], curve->cp[0], res, &started);
+		point_jacobian_add_digit(curve, naf_b[i], table, res, &started);
+	}
+	if (!started) {
+		bn_zero(&res->z);
+	}
+}
+
+// p = jp given zinv = 1 / jp->z
+static void jacobian_to_curve_inverted(const jacobian_curve_point *jp, const bignum256 *zinv, curve_point *p, const bignum256 *prime)
+{
+	bignum256 zinv2;
+	memcpy(&zinv2, zinv, sizeof(bignum256));
+	bn_multiply(zinv, &zinv2, prime); // z^-2
+	p->x = jp->x;
+	bn_multiply(&zinv2, &p->x, prime);
+	bn_mod(&p->x, prime);
+	bn_multiply(zinv, &zinv2, prime); // z^-3
+	p->y = jp->y;
+	bn_multiply(&zinv2, &p->y, prime);
+	bn_mod(&p->y, prime);
+}
+
+// reads r and s and computes R = k * G from r and the recovery id
+// returns 0 on success
+static int recover_nonce_point(const ecdsa_curve *curve, const uint8_t *sig, int recid, curve_point *R, bignum256 *r, bignum256 *s)
+{
+	bn_read_be(sig, r);
+	bn_read_be(sig + 32, s);
+	if (recid < 0 || recid > 3) {
+		return 1;
+	}
+	if (!bn_is_less(r, &curve->order) || bn_is_zero(r)) {
+		return 1;
+	}
+	if (!bn_is_less(s, &curve->order) || bn_is_zero(s)) {
+		return 1;
+	}
+	memcpy(&R->x, r, sizeof(bignum256));
+	if (recid & 2) {
+		bn_add(&R->x, &curve->order);
+		if (!bn_is_less(&R->x, &curve->prime)) {
+			return 1;
+		}
+	}
+	uncompress_coords(curve, recid & 1, &R->x, &R->y);
+	if (!ecdsa_validate_pubkey(curve, R)) {
+		return 1;
+	}
+	return 0;
+}
+
+// recovers up to RECOVER_BATCH public keys with four field inversions in total
+static size_t recover_chunk(const ecdsa_curve *curve, uint8_t *pub_keys, const uint8_t *sigs, const uint8_t *digests, const uint8_t *recids, int *results, size_t count)
+{
+	curve_point R[RECOVER_BATCH], twoR[RECOVER_BATCH];
+	curve_point table[RECOVER_BATCH][8];
+	jacobian_curve_point jp[RECOVER_BATCH][8];
+	bignum256 u1[RECOVER_BATCH], u2[RECOVER_BATCH];
+	bignum256 z[RECOVER_BATCH * 8], scratch[RECOVER_BATCH * 8];
+	const bignum256 *prime = &curve->prime;
+	const bignum256 *order = &curve->order;
+	size_t i, j, recovered = 0;
+
+	for (i = 0; i < count; i++) {
+		results[i] = recover_nonce_point(curve, sigs + 64 * i, recids[i], &R[i], &z[i], &u2[i]);
+		if (results[i]) {
+			bn_zero(&z[i]);
+		}
+	}
+
+	// z = r^-1
+	bn_batch_inverse(z, count, order, scratch);
+	for (i = 0; i < count; i++) {
+		if (results[i]) {
+			continue;
+		}
+		// u1 = -digest * r^-1, u2 = s * r^-1
+		bn_read_be(digests + 32 * i, &u1[i]);
+		bn_subtractmod(order, &u1[i], &u1[i], order);
+		bn_fast_mod(&u1[i], order);
+		bn_mod(&u1[i], order);
+		bn_multiply(&z[i], &u1[i], order);
+		bn_mod(&u1[i], order);
+		bn_multiply(&z[i], &u2[i], order);
+		bn_mod(&u2[i], order);
+	}
+
+	// 2R
+	for (i = 0; i < count; i++) {
+		bn_zero(&z[i]);
+		if (results[i]) {
+			continue;
+		}
+		jp[i][0].x = R[i].x;
+		jp[i][0].y = R[i].y;
+		bn_one(&jp[i][0].z);
+		point_jacobian_double(&jp[i][0], curve);
+		z[i] = jp[i][0].z;
+	}
+	bn_batch_inverse(z, count, prime, scratch);
+	for (i = 0; i < count; i++) {
+		if (!results[i]) {
+			jacobian_to_curve_inverted(&jp[i][0], &z[i], &twoR[i], prime);
+		}
+	}
+
+	// R, 3R, ..., 15R
+	for (i = 0; i < count; i++) {
+		for (j = 0; j < 8; j++) {
+			bn_zero(&z[8 * i + j]);
+		}
+		if (results[i]) {
+			continue;
+		}
+		table[i][0] = R[i];
+		jp[i][0].x = R[i].x;
+		jp[i][0].y = R[i].y;
+		bn_one(&jp[i][0].z);
+		for (j = 1; j < 8; j++) {
+			jp[i][j] = jp[i][j - 1];
+			point_jacobian_add(&twoR[i], &jp[i][j], curve);
+			z[8 * i + j] = jp[i][j].z;
+		}
+	}
+	bn_batch_inverse(z, 8 * count, prime, scratch);
+	for (i = 0; i < count; i++) {
+		if (results[i]) {
+			continue;
+		}
+		for (j = 1; j < 8; j++) {
+			jacobian_to_curve_inverted(&jp[i][j], &z[8 * i + j], &table[i][j], prime);
+		}
+	}
+
+	// Pub = r^-1 (s R - digest G) = u1 G + u2 R
+	for (i = 0; i < count; i++) {
+		bn_zero(&z[i]);
+		if (results[i]) {
+			continue;
+		}
+		point_joint_multiply(curve, &u1[i], &u2[i], table[i], WNAF_WINDOW, &jp[i][0]);
+		z[i] = jp[i][0].z;
+	}
+	bn_batch_inverse(z, count, prime, scratch);
+	for (i = 0; i < count; i++) {
+		if (results[i]) {
+			continue;
+		}
+		if (bn_is_zero(&z[i])) {
+			results[i] = 1;
+			continue;
+		}
+		jacobian_to_curve_inverted(&jp[i][0], &z[i], &R[i], prime);
+		pub_keys[65 * i] = 0x04;
+		bn_write_be(&R[i].x, pub_keys + 65 * i + 1);
+		bn_write_be(&R[i].y, pub_keys + 65 * i + 33);
+		recovered++;
+	}
+	return recovered;
+}
+
+// Computes public keys from signatures and recovery ids, like ecdsa_recover_pub_from_sig.
+// pub_keys receives count 65 byte keys, results[i] is 0 if the i-th key was recovered.
+// returns the number of keys recovered
+size_t ecdsa_recover_pub_from_sig_batch(const ecdsa_curve *curve, uint8_t *pub_keys, const uint8_t *sigs, const uint8_t *digests, const uint8_t *recids, int *results, size_t count)
+{
+	size_t offset, size, recovered = 0;
+	for (offset = 0; offset < count; offset += size) {
+		size = count - offset < RECOVER_BATCH ? count - offset : RECOVER_BATCH;
+		recovered += recover_chunk(curve, pub_keys + 65 * offset, sigs + 64 * offset, digests + 32 * offset, recids + offset, results + offset, size);
+	}
+	return recovered;
+}
+
 // returns 0 if verification succeeded
 int ecdsa_verify_digest(const ecdsa_curve *curve, const uint8_t *pub_key, const uint8_t *sig, const uint8_t *digest)
 {
-	curve_point pub, res;
-	bignum256 r, s, z;
+	curve_point pub;
+	int result;
 
 	if (!ecdsa_read_pubkey(curve, pub_key, &pub)) {
 		return 1;
 	}
+	result = ecdsa_verify_digest_point(curve, &pub, sig, digest);
+	memzero(&pub, sizeof(pub));
+	return result;
+}
 
-	bn_read_be(sig, &r);
-	bn_read_be(sig + 32, &s);
+// reads r and s and computes u1 = z * s^-1 and u2 = r * s^-1
+// returns 0 on success, the error code of ecdsa_verify_digest otherwise
+static int verify_scalars(const ecdsa_curve *curve, const uint8_t *sig, const uint8_t *digest, bignum256 *r, bignum256 *u1, bignum256 *u2)
+{
+	bn_read_be(sig, r);
+	bn_read_be(sig + 32, u2);
 
-	bn_read_be(digest, &z);
+	bn_read_be(digest, u1);
 
-	if (bn_is_zero(&r) || bn_is_zero(&s) ||
-		(!bn_is_less(&r, &curve->order)) ||
-		(!bn_is_less(&s, &curve->order))) return 2;
+	if (bn_is_zero(r) || bn_is_zero(u2) ||
+		(!bn_is_less(r, &curve->order)) ||
+		(!bn_is_less(u2, &curve->order))) return 2;
 
-	bn_inverse(&s, &curve->order); // s^-1
-	bn_multiply(&s, &z, &curve->order); // z*s^-1
-	bn_mod(&z, &curve->order);
-	bn_multiply(&r, &s, &curve->order); // r*s^-1
-	bn_mod(&s, &curve->order);
+	bn_inverse(u2, &curve->order); // s^-1
+	bn_multiply(u2, u1, &curve->order); // z*s^-1
+	bn_mod(u1, &curve->order);
+	bn_multiply(r, u2, &curve->order); // r*s^-1
+	bn_mod(u2, &curve->order);
 
-	int result = 0;
-	if (bn_is_zero(&z)) {
+	if (bn_is_zero(u1)) {
 		// our message hashes to zero
 		// I don't expect this to happen any time soon
-		result = 3;
-	} else {
-		scalar_multiply(curve, &z, &res);
+		return 3;
 	}
+	return 0;
+}
 
+// same as ecdsa_verify_digest with a public key that was already read and validated
+// returns 0 if verification succeeded
+int ecdsa_verify_digest_point(const ecdsa_curve *curve, const curve_point *pub_point, const uint8_t *sig, const uint8_t *digest)
+{
+	curve_point pub, res;
+	bignum256 r, s, z;
+
+	int result = verify_scalars(curve, sig, digest, &r, &z, &s);
 	if (result == 0) {
+		scalar_multiply(curve, &z, &res);
+
 		// both pub and res can be infinity, can have y = 0 OR can be equal -> false negative
-		point_multiply(curve, &s, &pub, &pub);
+		point_multiply(curve, &s, pub_point, &pub);
 		point_add(curve, &pub, &res);
 		bn_mod(&(res.x), &curve->order);
 		// signature does not match
@@ -1066,6 +1568,115 @@ int ecdsa_verify_digest(const ecdsa_curve *curve, const uint8_t *pub_key, const
 	return result;
 }
 
+// computes the count odd multiples pub, 3 pub, ... with a single inversion
+// count <= ECDSA_VERIFY_CTX_SIZE
+static void point_odd_multiples(const ecdsa_curve *curve, const curve_point *pub, curve_point *table, int count)
+{
+	curve_point twice;
+	jacobian_curve_point jp[ECDSA_VERIFY_CTX_SIZE];
+	bignum256 z[ECDSA_VERIFY_CTX_SIZE], scratch[ECDSA_VERIFY_CTX_SIZE];
+	int j;
+
+	twice = *pub;
+	point_double(curve, &twice);
+	table[0] = *pub;
+	jp[0].x = pub->x;
+	jp[0].y = pub->y;
+	bn_one(&jp[0].z);
+	bn_zero(&z[0]);
+	for (j = 1; j < count; j++) {
+		jp[j] = jp[j - 1];
+		point_jacobian_add(&twice, &jp[j], curve);
+		z[j] = jp[j].z;
+	}
+	bn_batch_inverse(z, count, &curve->prime, scratch);
+	for (j = 1; j < count; j++) {
+		jacobian_to_curve_inverted(&jp[j], &z[j], &table[j], &curve->prime);
+	}
+}
+
+// computes the odd multiples pub, 3 pub, ..., 15 pub used by ecdsa_verify_digest_table
+// pub must be a valid public key
+void ecdsa_point_table(const ecdsa_curve *curve, const curve_point *pub, curve_point table[8])
+{
+	point_odd_multiples(curve, pub, table, 8);
+}
+
+// u1 * G + u2 * pub with the odd multiples of pub up to the given window, compared against r
+// returns 0 if verification succeeded
+static int verify_joint(const ecdsa_curve *curve, const curve_point *table, int window, const uint8_t *sig, const uint8_t *digest)
+{
+	jacobian_curve_point jp;
+	curve_point res;
+	bignum256 r, u1, u2;
+
+	int result = verify_scalars(curve, sig, digest, &r, &u1, &u2);
+	if (result == 0) {
+		point_joint_multiply(curve, &u1, &u2, table, window, &jp);
+		bn_mod(&jp.z, &curve->prime);
+		if (bn_is_zero(&jp.z)) {
+			// result or an intermediate point at infinity -> false negative
+			result = 4;
+		} else {
+			jacobian_to_curve(&jp, &res, &curve->prime);
+			bn_mod(&(res.x), &curve->order);
+			// signature does not match
+			if (!bn_is_equal(&res.x, &r)) {
+				result = 5;
+			}
+		}
+	}
+
+	memzero(&jp, sizeof(jp));
+	memzero(&res, sizeof(res));
+	memzero(&r, sizeof(r));
+	memzero(&u1, sizeof(u1));
+	memzero(&u2, sizeof(u2));
+
+	return result;
+}
+
+// same as ecdsa_verify_digest with the odd multiples of the public key from ecdsa_point_table
+// computes u1 * G + u2 * pub in a single joint multiplication
+// returns 0 if verification succeeded
+int ecdsa_verify_digest_table(const ecdsa_curve *curve, const curve_point table[8], const uint8_t *sig, const uint8_t *digest)
+{
+	return verify_joint(curve, table, WNAF_WINDOW, sig, digest);
+}
+
+// reads and validates pub_key and precomputes its wide wNAF table
+// returns NULL if the key is invalid or the allocation fails
+ecdsa_verify_ctx *ecdsa_verify_ctx_create(const ecdsa_curve *curve, const uint8_t *pub_key)
+{
+	curve_point pub;
+	if (!ecdsa_read_pubkey(curve, pub_key, &pub)) {
+		return NULL;
+	}
+	ecdsa_verify_ctx *ctx = malloc(sizeof(ecdsa_verify_ctx));
+	if (ctx != NULL) {
+		point_odd_multiples(curve, &pub, ctx->table, ECDSA_VERIFY_CTX_SIZE);
+	}
+	memzero(&pub, sizeof(pub));
+	return ctx;
+}
+
+void ecdsa_verify_ctx_free(ecdsa_verify_ctx *ctx)
+{
+	free(ctx);
+}
+
+size_t ecdsa_verify_ctx_size(void)
+{
+	return sizeof(ecdsa_verify_ctx);
+}
+
+// same as ecdsa_verify_digest with a context from ecdsa_verify_ctx_create
+// returns 0 if verification succeeded
+int ecdsa_verify_digest_with_ctx(const ecdsa_curve *curve, const ecdsa_verify_ctx *ctx, const uint8_t *sig, const uint8_t *digest)
+{
+	return verify_joint(curve, ctx->table, ECDSA_VERIFY_CTX_WINDOW, sig, digest);
+}
+
 int ecdsa_sig_to_der(const uint8_t *sig, uint8_t *der)
 {
 	int i;
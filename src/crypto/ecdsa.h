@@ -50,6 +50,14 @@ typedef struct {
 	const curve_point cp[64][8];
 } ecdsa_curve;
 
+// curve point x/z^2 and y/z^3
+typedef struct jacobian_curve_point {
+	bignum256 x, y, z;
+} jacobian_curve_point;
+
+// precomputed verification context for one public key, see ecdsa_verify_ctx_create
+typedef struct ecdsa_verify_ctx ecdsa_verify_ctx;
+
 // 4 byte prefix + 40 byte data (segwit)
 // 1 byte prefix + 64 byte data (cashaddr)
 #define MAX_ADDR_RAW_SIZE 65
@@ -72,7 +80,16 @@ int point_is_infinity(const curve_point *p);
 int point_is_equal(const curve_point *p, const curve_point *q);
 int point_is_negative_of(const curve_point *p, const curve_point *q);
 void scalar_multiply(const ecdsa_curve *curve, const bignum256 *k, curve_point *res);
+int scalar_multiply_jacobian(const ecdsa_curve *curve, const bignum256 *k, jacobian_curve_point *jres);
+void curve_to_jacobian(const curve_point *p, jacobian_curve_point *jp, const bignum256 *prime);
+void jacobian_to_curve(const jacobian_curve_point *jp, curve_point *p, const bignum256 *prime);
+void jacobian_to_curve_batch(const jacobian_curve_point *jp, curve_point *p, size_t count, const bignum256 *prime, bignum256 *scratch);
+void point_jacobian_add(const curve_point *p1, jacobian_curve_point *p2, const ecdsa_curve *curve);
+void point_jacobian_double(jacobian_curve_point *p, const ecdsa_curve *curve);
 int ecdh_multiply(const ecdsa_curve *curve, const uint8_t *priv_key, const uint8_t *pub_key, uint8_t *session_key);
+int ecdh_multiply_x(const ecdsa_curve *curve, const uint8_t *priv_key, const uint8_t *pub_key, uint8_t *session_x);
+// Batch functions set results[i] to 0 if item i succeeded and to 1 if it failed, and return the number of successes.
+size_t ecdh_multiply_x_batch(const ecdsa_curve *curve, const uint8_t *priv_key, const uint8_t *pub_keys, size_t count, uint8_t *session_xs, int *results);
 void uncompress_coords(const ecdsa_curve *curve, uint8_t odd, const bignum256 *x, bignum256 *y);
 int ecdsa_uncompress_pubkey(const ecdsa_curve *curve, const uint8_t *pub_key, uint8_t *uncompressed);
 
@@ -88,7 +105,18 @@ int ecdsa_read_pubkey(const ecdsa_curve *curve, const uint8_t *pub_key, curve_po
 int ecdsa_validate_pubkey(const ecdsa_curve *curve, const curve_point *pub);
 int ecdsa_verify(const ecdsa_curve *curve, HasherType hasher_sign, const uint8_t *pub_key, const uint8_t *sig, const uint8_t *msg, uint32_t msg_len);
 int ecdsa_verify_digest(const ecdsa_curve *curve, const uint8_t *pub_key, const uint8_t *sig, const uint8_t *digest);
+int ecdsa_verify_digest_point(const ecdsa_curve *curve, const curve_point *pub_point, const uint8_t *sig, const uint8_t *digest);
+void ecdsa_point_table(const ecdsa_curve *curve, const curve_point *pub, curve_point table[8]);
+int ecdsa_verify_digest_table(const ecdsa_curve *curve, const curve_point table[8], const uint8_t *sig, const uint8_t *digest);
+// Returns a verification context for pub_key, or NULL if the key is invalid or the allocation fails.
+ecdsa_verify_ctx *ecdsa_verify_ctx_create(const ecdsa_curve *curve, const uint8_t *pub_key);
+void ecdsa_verify_ctx_free(ecdsa_verify_ctx *ctx);
+// Returns the number of bytes a context takes.
+size_t ecdsa_verify_ctx_size(void);
+int ecdsa_verify_digest_with_ctx(const ecdsa_curve *curve, const ecdsa_verify_ctx *ctx, const uint8_t *sig, const uint8_t *digest);
 int ecdsa_recover_pub_from_sig (const ecdsa_curve *curve, uint8_t *pub_key, const uint8_t *sig, const uint8_t *digest, int recid);
+// results[i] is 0 if the i-th key was recovered, see ecdh_multiply_x_batch.
+size_t ecdsa_recover_pub_from_sig_batch(const ecdsa_curve *curve, uint8_t *pub_keys, const uint8_t *sigs, const uint8_t *digests, const uint8_t *recids, int *results, size_t count);
 int ecdsa_sig_to_der(const uint8_t *sig, uint8_t *der);
 
 #ifdef __cplusplus
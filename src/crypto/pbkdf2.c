@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2013-2014 Tomas Dzetkulic
+ * Copyright (c) 2013-2014 Pavol Rusnak
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "hmac.h"
+#include "memzero.h"
+#include "pbkdf2.h"
+#include "sha2.h"
+
+#define SHA512_WORDS (SHA512_DIGEST_LENGTH / sizeof(uint64_t))
+
+// Midstates of one derivation block. `g` is an inner or outer hash padded into a full message block.
+typedef struct {
+	uint64_t odig[SHA512_WORDS];
+	uint64_t idig[SHA512_WORDS];
+	uint64_t f[SHA512_WORDS];
+	uint64_t g[SHA512_BLOCK_LENGTH / sizeof(uint64_t)];
+} PBKDF2_SHA512_BLOCK;
+
+// Hashes the pads and computes U_1 = HMAC(pass, salt || INT(blocknr)).
+static void pbkdf2_hmac_sha512_first(PBKDF2_SHA512_BLOCK *b, const uint8_t *pass, uint32_t passlen, const uint8_t *salt, uint32_t saltlen, uint32_t blocknr)
+{
+	SHA512_CTX ctx;
+	const uint8_t be[4] = {blocknr >> 24, blocknr >> 16, blocknr >> 8, blocknr};
+
+	hmac_sha512_prepare(pass, passlen, b->odig, b->idig);
+	memzero(b->g, sizeof(b->g));
+	b->g[8] = 0x8000000000000000;
+	b->g[15] = (SHA512_BLOCK_LENGTH + SHA512_DIGEST_LENGTH) * 8;
+
+	memcpy(ctx.state, b->idig, sizeof(b->idig));
+	ctx.bitcount[0] = SHA512_BLOCK_LENGTH * 8;
+	ctx.bitcount[1] = 0;
+	sha512_Update(&ctx, salt, saltlen);
+	sha512_Update(&ctx, be, sizeof(be));
+	sha512_Final(&ctx, (uint8_t *)b->g);
+#if BYTE_ORDER == LITTLE_ENDIAN
+	for (size_t k = 0; k < SHA512_WORDS; k++) {
+		REVERSE64(b->g[k], b->g[k]);
+	}
+#endif
+	sha512_Transform(b->odig, b->g, b->f);
+	memcpy(b->g, b->f, SHA512_DIGEST_LENGTH);
+}
+
+// Writes up to one digest of the derived key.
+static void pbkdf2_hmac_sha512_write(const uint64_t *f, uint8_t *key, uint32_t size)
+{
+	for (uint32_t k = 0; k < size; k++) {
+		key[k] = f[k / 8] >> (56 - 8 * (k % 8));
+	}
+}
+
+void pbkdf2_hmac_sha512(const uint8_t *pass, uint32_t passlen, const uint8_t *salt, uint32_t saltlen, uint32_t iterations, uint8_t *key, uint32_t keylen)
+{
+	PBKDF2_SHA512_BLOCK b;
+	for (uint32_t blocknr = 1; keylen > 0; blocknr++) {
+		pbkdf2_hmac_sha512_first(&b, pass, passlen, salt, saltlen, blocknr);
+		for (uint32_t i = 1; i < iterations; i++) {
+			sha512_Transform(b.idig, b.g, b.g);
+			sha512_Transform(b.odig, b.g, b.g);
+			for (size_t k = 0; k < SHA512_WORDS; k++) {
+				b.f[k] ^= b.g[k];
+			}
+		}
+		const uint32_t size = keylen < SHA512_DIGEST_LENGTH ? keylen : SHA512_DIGEST_LENGTH;
+		pbkdf2_hmac_sha512_write(b.f, key, size);
+		key += size;
+		keylen -= size;
+	}
+	memzero(&b, sizeof(b));
+}
+
+void pbkdf2_hmac_sha512_batch(const uint8_t *const *pass, const uint32_t *passlen, const uint8_t *const *salt, const uint32_t *saltlen, uint32_t iterations, uint8_t *const *key, uint32_t keylen, size_t count)
+{
+	// Lane-interleaved midstates, see sha512_Transform_lanes.
+	uint64_t odig[SHA512_WORDS][SHA512_LANES], idig[SHA512_WORDS][SHA512_LANES];
+	uint64_t f[SHA512_WORDS][SHA512_LANES], g[16][SHA512_LANES];
+	uint64_t out[SHA512_WORDS];
+	PBKDF2_SHA512_BLOCK b;
+
+	for (size_t first = 0; first < count; first += SHA512_LANES) {
+		const size_t lanes = count - first < SHA512_LANES ? count - first : SHA512_LANES;
+		for (uint32_t offset = 0, blocknr = 1; offset < keylen; offset += SHA512_DIGEST_LENGTH, blocknr++) {
+			// Unused lanes of the last group repeat its first derivation.
+			for (size_t l = 0; l < SHA512_LANES; l++) {
+				const size_t n = first + (l < lanes ? l : 0);
+				pbkdf2_hmac_sha512_first(&b, pass[n], passlen[n], salt[n], saltlen[n], blocknr);
+				for (size_t k = 0; k < 16; k++) {
+					if (k < SHA512_WORDS) {
+						odig[k][l] = b.odig[k];
+						idig[k][l] = b.idig[k];
+						f[k][l] = b.f[k];
+					}
+					g[k][l] = b.g[k];
+				}
+			}
+			for (uint32_t i = 1; i < iterations; i++) {
+				sha512_Transform_lanes(&idig[0][0], &g[0][0], &g[0][0]);
+				sha512_Transform_lanes(&odig[0][0], &g[0][0], &g[0][0]);
+				for (size_t k = 0; k < SHA512_WORDS; k++) {
+					for (size_t l = 0; l < SHA512_LANES; l++) {
+						f[k][l] ^= g[k][l];
+					}
+				}
+			}
+			const uint32_t size = keylen - offset < SHA512_DIGEST_LENGTH ? keylen - offset : SHA512_DIGEST_LENGTH;
+			for (size_t l = 0; l < lanes; l++) {
+				for (size_t k = 0; k < SHA512_WORDS; k++) {
+					out[k] = f[k][l];
+				}
+				pbkdf2_hmac_sha512_write(out, key[first + l] + offset, size);
+			}
+		}
+	}
+	memzero(&b, sizeof(b));
+	memzero(odig, sizeof(odig));
+	memzero(idig, sizeof(idig));
+	memzero(f, sizeof(f));
+	memzero(g, sizeof(g));
+	memzero(out, sizeof(out));
+}
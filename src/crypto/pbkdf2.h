@@ -0,0 +1,45 @@
+/**
+ * Copyright (c) 2013-2014 Tomas Dzetkulic
+ * Copyright (c) 2013-2014 Pavol Rusnak
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __PBKDF2_H__
+#define __PBKDF2_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// PBKDF2 (RFC 8018) with HMAC-SHA512 as the pseudorandom function, as used by BIP39 to stretch a mnemonic into a seed.
+// The password pads are hashed once, and each iteration compresses two fixed-size blocks from their midstates.
+void pbkdf2_hmac_sha512(const uint8_t *pass, uint32_t passlen, const uint8_t *salt, uint32_t saltlen, uint32_t iterations, uint8_t *key, uint32_t keylen);
+
+// Runs `count` independent derivations with the same iteration count and key length, SHA512_LANES at a time.
+void pbkdf2_hmac_sha512_batch(const uint8_t *const *pass, const uint32_t *passlen, const uint8_t *const *salt, const uint32_t *saltlen, uint32_t iterations, uint8_t *const *key, uint32_t keylen, size_t count);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
@@ -22,20 +22,85 @@
  */
 
 #include "rand.h"
+#include "memzero.h"
 
-#include <pcg_random.hpp>
+#include <algorithm>
+#include <atomic>
+#include <pthread.h>
 #include <random>
+#include <string.h>
 
-uint32_t __attribute__((weak)) random32() {
-    pcg_extras::seed_seq_from<std::random_device> seed_source;
-    pcg32 rng(seed_source);
-    return rng();
+#if defined(__linux__)
+#include <errno.h>
+#include <sys/random.h>
+#endif
+
+// Random bytes are read from the operating system's CSPRNG in blocks, so a signature's blinding factor doesn't take
+// a system call per word. Each thread has its own block, consumed bytes are wiped, and a forked child discards the
+// blocks it inherited so it never repeats its parent's output.
+namespace {
+
+struct Block {
+    uint8_t bytes[256];
+    size_t used = sizeof(bytes);
+    uint32_t generation = 0;
+
+    ~Block() { memzero(bytes, sizeof(bytes)); }
+};
+
+std::atomic<uint32_t> forkGeneration{1};
+
+void discardInheritedBlocks() {
+    forkGeneration.fetch_add(1, std::memory_order_relaxed);
 }
 
+const int atforkRegistered = pthread_atfork(nullptr, nullptr, discardInheritedBlocks);
+
+void fill(uint8_t *buf, size_t len) {
+#if defined(__linux__)
+    while (len > 0) {
+        const auto result = getrandom(buf, len, 0);
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        buf += result;
+        len -= static_cast<size_t>(result);
+    }
+#endif
+    // Without getrandom the random device reads the operating system's CSPRNG.
+    if (len > 0) {
+        std::random_device device;
+        for (size_t i = 0; i < len; i += 1) {
+            buf[i] = static_cast<uint8_t>(device());
+        }
+    }
+}
+
+} // namespace
+
 void __attribute__((weak)) random_buffer(uint8_t *buf, size_t len) {
-    pcg_extras::seed_seq_from<std::random_device> seed_source;
-    pcg32 rng(seed_source);
-    for (auto i = 0; i < len; i += 1) {
-        buf[i] = rng();
+    thread_local Block block;
+    const auto generation = forkGeneration.load(std::memory_order_relaxed);
+    while (len > 0) {
+        if (block.used == sizeof(block.bytes) || block.generation != generation) {
+            fill(block.bytes, sizeof(block.bytes));
+            block.used = 0;
+            block.generation = generation;
+        }
+        const auto count = std::min(len, sizeof(block.bytes) - block.used);
+        memcpy(buf, block.bytes + block.used, count);
+        memzero(block.bytes + block.used, count);
+        block.used += count;
+        buf += count;
+        len -= count;
     }
 }
+
+uint32_t __attribute__((weak)) random32() {
+    uint32_t value;
+    random_buffer(reinterpret_cast<uint8_t *>(&value), sizeof(value));
+    return value;
+}
@@ -1131,6 +1131,98 @@ void sha512_Transform(const sha2_word64* state_in, const sha2_word64* data, sha2
 
 #endif /* SHA2_UNROLL_TRANSFORM */
 
+#if defined(__GNUC__)
+
+/* Multi-lane SHA-512 on GCC and Clang vector extensions: each word holds one value per lane. */
+typedef sha2_word64 sha2_lanes64 __attribute__((vector_size(SHA512_LANES * sizeof(sha2_word64))));
+
+#define ROUND512_LANES(a,b,c,d,e,f,g,h)	\
+	if (j >= 16) { \
+		W[j&0x0f] += sigma1_512(W[(j+14)&0x0f]) + W[(j+9)&0x0f] + sigma0_512(W[(j+1)&0x0f]); \
+	} \
+	T1 = (h) + Sigma1_512(e) + Ch((e), (f), (g)) + K512[j] + W[j&0x0f]; \
+	(d) += T1; \
+	(h) = T1 + Sigma0_512(a) + Maj((a), (b), (c)); \
+	j++
+
+void sha512_Transform_lanes(const sha2_word64* state_in, const sha2_word64* data, sha2_word64* state_out) {
+	sha2_lanes64	s[8], W[16], T1;
+	int		j = 0;
+
+	memcpy(s, state_in, sizeof(s));
+	memcpy(W, data, sizeof(W));
+	do {
+		ROUND512_LANES(s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7]);
+		ROUND512_LANES(s[7],s[0],s[1],s[2],s[3],s[4],s[5],s[6]);
+		ROUND512_LANES(s[6],s[7],s[0],s[1],s[2],s[3],s[4],s[5]);
+		ROUND512_LANES(s[5],s[6],s[7],s[0],s[1],s[2],s[3],s[4]);
+		ROUND512_LANES(s[4],s[5],s[6],s[7],s[0],s[1],s[2],s[3]);
+		ROUND512_LANES(s[3],s[4],s[5],s[6],s[7],s[0],s[1],s[2]);
+		ROUND512_LANES(s[2],s[3],s[4],s[5],s[6],s[7],s[0],s[1]);
+		ROUND512_LANES(s[1],s[2],s[3],s[4],s[5],s[6],s[7],s[0]);
+	} while (j < 80);
+
+	/* Compute the current intermediate hash values */
+	for (j = 0; j < 8; j++) {
+		sha2_lanes64 in;
+		memcpy(&in, state_in + j * SHA512_LANES, sizeof(in));
+		s[j] += in;
+	}
+	memcpy(state_out, s, sizeof(s));
+
+	/* Clean up */
+	memzero(s, sizeof(s));
+	memzero(W, sizeof(W));
+	memzero(&T1, sizeof(T1));
+}
+
+#else /* __GNUC__ */
+
+/* Multi-lane SHA-512 round: each step is a loop over the lanes. */
+#define ROUND512_LANES(a,b,c,d,e,f,g,h)	\
+	if (j >= 16) { \
+		for (l = 0; l < SHA512_LANES; l++) { \
+			W[j&0x0f][l] += sigma1_512(W[(j+14)&0x0f][l]) + W[(j+9)&0x0f][l] + \
+			                sigma0_512(W[(j+1)&0x0f][l]); \
+		} \
+	} \
+	for (l = 0; l < SHA512_LANES; l++) { \
+		T1 = (h)[l] + Sigma1_512((e)[l]) + Ch((e)[l], (f)[l], (g)[l]) + K512[j] + W[j&0x0f][l]; \
+		(d)[l] += T1; \
+		(h)[l] = T1 + Sigma0_512((a)[l]) + Maj((a)[l], (b)[l], (c)[l]); \
+	} \
+	j++
+
+void sha512_Transform_lanes(const sha2_word64* state_in, const sha2_word64* data, sha2_word64* state_out) {
+	sha2_word64	s[8][SHA512_LANES], W[16][SHA512_LANES], T1;
+	int		j = 0, l;
+
+	memcpy(s, state_in, sizeof(s));
+	memcpy(W, data, sizeof(W));
+	do {
+		ROUND512_LANES(s[0],s[1],s[2],s[3],s[4],s[5],s[6],s[7]);
+		ROUND512_LANES(s[7],s[0],s[1],s[2],s[3],s[4],s[5],s[6]);
+		ROUND512_LANES(s[6],s[7],s[0],s[1],s[2],s[3],s[4],s[5]);
+		ROUND512_LANES(s[5],s[6],s[7],s[0],s[1],s[2],s[3],s[4]);
+		ROUND512_LANES(s[4],s[5],s[6],s[7],s[0],s[1],s[2],s[3]);
+		ROUND512_LANES(s[3],s[4],s[5],s[6],s[7],s[0],s[1],s[2]);
+		ROUND512_LANES(s[2],s[3],s[4],s[5],s[6],s[7],s[0],s[1]);
+		ROUND512_LANES(s[1],s[2],s[3],s[4],s[5],s[6],s[7],s[0]);
+	} while (j < 80);
+
+	/* Compute the current intermediate hash values */
+	for (j = 0; j < 8 * SHA512_LANES; j++) {
+		state_out[j] = state_in[j] + s[j / SHA512_LANES][j % SHA512_LANES];
+	}
+
+	/* Clean up */
+	memzero(s, sizeof(s));
+	memzero(W, sizeof(W));
+	T1 = 0;
+}
+
+#endif /* __GNUC__ */
+
 void sha512_Update(SHA512_CTX* context, const sha2_byte *data, size_t len) {
 	unsigned int	freespace, usedspace;
 
@@ -48,6 +48,9 @@ extern "C" {
 #define SHA512_DIGEST_LENGTH		64
 #define SHA512_DIGEST_STRING_LENGTH	(SHA512_DIGEST_LENGTH * 2 + 1)
 
+/* Number of independent blocks sha512_Transform_lanes compresses at once. */
+#define SHA512_LANES			4
+
 typedef struct _SHA1_CTX {
 	uint32_t	state[5];
 	uint64_t	bitcount;
@@ -110,6 +113,9 @@ void sha256_Raw(const uint8_t*, size_t, uint8_t[SHA256_DIGEST_LENGTH]);
 char* sha256_Data(const uint8_t*, size_t, char[SHA256_DIGEST_STRING_LENGTH]);
 
 void sha512_Transform(const uint64_t* state_in, const uint64_t* data, uint64_t* state_out);
+/* Compresses SHA512_LANES blocks with separate states. Word i of lane l is at index i * SHA512_LANES + l in every
+ * argument, which lets compilers vectorize the rounds across lanes. */
+void sha512_Transform_lanes(const uint64_t* state_in, const uint64_t* data, uint64_t* state_out);
 void sha512_Init(SHA512_CTX*);
 void sha512_Update(SHA512_CTX*, const uint8_t*, size_t);
 void sha512_Final(SHA512_CTX*, uint8_t[SHA512_DIGEST_LENGTH]);
@@ -0,0 +1,89 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "AccountRegistry.h"
+#include "HexCoding.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace Binance {
+
+static const auto privateKey = parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9");
+
+TEST(AccountRegistry, Registry) {
+    AccountRegistry accounts;
+    auto account = accounts.add("main", privateKey, 12, 35);
+    ASSERT_EQ(accounts.size(), 1);
+    ASSERT_EQ(accounts.find("main"), account);
+    ASSERT_EQ(accounts.find("other"), nullptr);
+    ASSERT_EQ(account->accountNumber, 12);
+    ASSERT_EQ(account->privateKey, privateKey);
+    ASSERT_EQ(hex(account->publicKey), "029729a52e4e3c2b4a4e52aa74033eedaf8ba1df5ab6d1f518fd69e67bbd309b0e");
+
+    // Keys of the wrong size are rejected when the account is registered, not when it signs.
+    ASSERT_THROW(accounts.add("short", Data(privateKey.begin(), privateKey.end() - 1), 1, 0), std::invalid_argument);
+    ASSERT_EQ(accounts.find("short"), nullptr);
+
+    ASSERT_TRUE(accounts.remove("main"));
+    ASSERT_FALSE(accounts.remove("main"));
+    ASSERT_EQ(account->nextSequence(), 35);
+}
+
+TEST(AccountRegistry, RollbackAndResync) {
+    Account account(privateKey, 1, 10);
+    auto first = account.nextSequence();
+    auto second = account.nextSequence();
+    ASSERT_EQ(first, 10);
+    ASSERT_EQ(second, 11);
+
+    // Only the most recent reservation can be released.
+    ASSERT_FALSE(account.rollback(first));
+    ASSERT_TRUE(account.rollback(second));
+    ASSERT_EQ(account.sequence(), 11);
+
+    ASSERT_FALSE(account.needsResync());
+    account.markForResync();
+    ASSERT_TRUE(account.needsResync());
+    account.resync(42);
+    ASSERT_FALSE(account.needsResync());
+    ASSERT_EQ(account.nextSequence(), 42);
+}
+
+TEST(AccountRegistry, ConcurrentReservations) {
+    const auto threads = 8;
+    const auto reservations = 10000;
+    auto account = std::make_shared<Account>(privateKey, 1, 0);
+
+    std::vector<std::vector<int64_t>> reserved(threads);
+    std::vector<std::thread> pool;
+    for (auto i = 0; i < threads; i += 1) {
+        pool.emplace_back([&, i]() {
+            for (auto j = 0; j < reservations; j += 1) {
+                reserved[i].push_back(account->nextSequence());
+            }
+        });
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    std::vector<int64_t> all;
+    for (auto& values : reserved) {
+        all.insert(all.end(), values.begin(), values.end());
+    }
+    std::sort(all.begin(), all.end());
+    for (size_t i = 0; i < all.size(); i += 1) {
+        ASSERT_EQ(all[i], static_cast<int64_t>(i));
+    }
+    ASSERT_EQ(account->sequence(), threads * reservations);
+}
+
+} // namespace
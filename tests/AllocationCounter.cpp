@@ -0,0 +1,91 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "AllocationCounter.h"
+
+#include <cstdlib>
+#include <new>
+
+using namespace Binance;
+
+namespace {
+
+// Plain integers so counting never allocates or runs a thread_local constructor.
+thread_local uint64_t allocationCount = 0;
+thread_local uint64_t allocationBytes = 0;
+
+void* allocate(size_t size) {
+    allocationCount += 1;
+    allocationBytes += size;
+    if (auto pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+} // namespace
+
+void* operator new(size_t size) {
+    return allocate(size);
+}
+
+void* operator new[](size_t size) {
+    return allocate(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    allocationCount += 1;
+    allocationBytes += size;
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    allocationCount += 1;
+    allocationBytes += size;
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+AllocationCounter::AllocationCounter() {
+    reset();
+}
+
+uint64_t AllocationCounter::allocations() const {
+    return allocationCount - startAllocations;
+}
+
+uint64_t AllocationCounter::bytes() const {
+    return allocationBytes - startBytes;
+}
+
+void AllocationCounter::reset() {
+    startAllocations = allocationCount;
+    startBytes = allocationBytes;
+}
+
+uint64_t AllocationCounter::totalAllocations() {
+    return allocationCount;
+}
+
+uint64_t AllocationCounter::totalBytes() {
+    return allocationBytes;
+}
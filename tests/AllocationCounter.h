@@ -0,0 +1,43 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Binance {
+
+/// Counts heap allocations made by the current thread while it is alive.
+///
+/// Linking `AllocationCounter.cpp` replaces the global `operator new` and `operator delete` to keep per-thread
+/// totals. The library's C code does not allocate, so `operator new` sees every heap allocation on the paths under
+/// test.
+class AllocationCounter {
+public:
+    AllocationCounter();
+
+    /// Number of allocations since construction or the last `reset()`.
+    uint64_t allocations() const;
+
+    /// Bytes requested since construction or the last `reset()`.
+    uint64_t bytes() const;
+
+    void reset();
+
+    /// Allocations made by the current thread since it started.
+    static uint64_t totalAllocations();
+
+    /// Bytes requested by the current thread since it started.
+    static uint64_t totalBytes();
+
+private:
+    uint64_t startAllocations;
+    uint64_t startBytes;
+};
+
+} // namespace
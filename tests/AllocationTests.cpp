@@ -0,0 +1,124 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Address.h"
+#include "AllocationCounter.h"
+#include "Bech32.h"
+#include "HexCoding.h"
+#include "Messages.h"
+#include "Signer.h"
+#include "Verifier.h"
+#ifndef BINANCE_NO_PROTOBUF
+#include "Serialization.h"
+#endif
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace Binance {
+
+static const auto privateKey = parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9");
+static const auto keyhash = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+
+/// Counts the allocations of a call, after a warm-up call so one-time initialization doesn't count.
+template <typename F>
+static uint64_t allocations(F&& call) {
+    call();
+    auto counter = AllocationCounter();
+    call();
+    return counter.allocations();
+}
+
+static Messages::NewOrder makeOrder() {
+    auto order = Messages::NewOrder();
+    order.sender = keyhash;
+    order.id = "B6561DCC104130059A7C08F48C64610C1F6F9064-11";
+    order.symbol = "BTC-5C4_BNB";
+    order.ordertype = 2;
+    order.side = 1;
+    order.price = 100000000;
+    order.quantity = 1200000000;
+    order.timeinforce = 1;
+    return order;
+}
+
+TEST(Allocation, Counter) {
+    auto counter = AllocationCounter();
+    auto data = new Data(100);
+    ASSERT_EQ(counter.allocations(), 2);
+    ASSERT_EQ(counter.bytes(), sizeof(Data) + 100);
+    delete data;
+    counter.reset();
+    ASSERT_EQ(counter.allocations(), 0);
+}
+
+// Budgets are the current allocation counts. Lower them when a change removes allocations; a change that needs
+// to raise one should say why.
+
+TEST(Allocation, Encoding) {
+    const auto text = hex(keyhash);
+    ASSERT_LE(allocations([&] { parse_hex(text); }), 1);
+    ASSERT_LE(allocations([&] { hex(keyhash); }), 1);
+
+    const auto address = Address(Address::binanceHRP, keyhash);
+    const auto encoded = address.encode();
+    ASSERT_LE(allocations([&] { address.encode(); }), 1);
+    ASSERT_LE(allocations([&] { Bech32::decode(encoded); }), 1);
+    ASSERT_EQ(allocations([&] { Address::decode(encoded); }), 0);
+}
+
+#ifndef BINANCE_NO_PROTOBUF
+TEST(Allocation, Signer) {
+    auto order = NewOrder();
+    order.set_sender(keyhash.data(), keyhash.size());
+    order.set_id("B6561DCC104130059A7C08F48C64610C1F6F9064-11");
+    order.set_symbol("BTC-5C4_BNB");
+    order.set_ordertype(2);
+    order.set_side(1);
+    order.set_price(100000000);
+    order.set_quantity(1200000000);
+    order.set_timeinforce(1);
+    auto signer = Signer(order);
+    signer.accountNumber = 1;
+    signer.sequence = 10;
+    signer.privateKey = PrivateKey(privateKey);
+    ASSERT_LE(allocations([&] { signaturePreimage(signer); }), 38);
+    ASSERT_LE(allocations([&] { signer.sign(); }), 1);
+    ASSERT_LE(allocations([&] { signer.build(); }), 1);
+
+    auto buffer = Data(signer.encodedSize());
+    ASSERT_EQ(allocations([&] { signer.build(buffer); }), 0);
+    ASSERT_EQ(allocations([&] { signer.encodedSize(); }), 0);
+}
+#endif
+
+TEST(Allocation, EncodedSigner) {
+    const auto order = makeOrder();
+    const auto encoded = Messages::encodeOrder(order);
+    auto signer = Signer(encoded);
+    signer.accountNumber = 1;
+    signer.sequence = 10;
+    signer.privateKey = PrivateKey(privateKey);
+    ASSERT_LE(allocations([&] { Messages::encodeOrder(order); }), 1);
+    ASSERT_LE(allocations([&] { signer.sign(); }), 1);
+    ASSERT_LE(allocations([&] { signer.build(); }), 1);
+
+    auto buffer = Data(signer.encodedSize());
+    ASSERT_EQ(allocations([&] { signer.build(buffer); }), 0);
+    ASSERT_EQ(allocations([&] { signer.encodedSize(); }), 0);
+}
+
+TEST(Allocation, Verifier) {
+    const auto encoded = Messages::encodeOrder(makeOrder());
+    auto signer = Signer(encoded);
+    signer.privateKey = PrivateKey(privateKey);
+    const auto transaction = signer.build();
+    ASSERT_EQ(allocations([&] { verifyTransaction(transaction.data(), transaction.size()); }), 0);
+}
+
+} // namespace
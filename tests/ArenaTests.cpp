@@ -0,0 +1,191 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "AllocationCounter.h"
+#include "Arena.h"
+#include "HexCoding.h"
+#include "Messages.h"
+#include "Signer.h"
+
+#include <gtest/gtest.h>
+
+#include <stdint.h>
+#include <vector>
+
+namespace Binance {
+
+static const auto arenaKeyhash = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+
+TEST(Arena, Allocate) {
+    Arena arena(64);
+    auto first = static_cast<byte*>(arena.allocate(3, 1));
+    auto second = arena.allocate(8, 8);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(second) % 8, 0);
+    ASSERT_GE(static_cast<byte*>(second), first + 3);
+    ASSERT_EQ(arena.capacity(), 64);
+
+    // Larger than the first block, adds one.
+    auto large = static_cast<byte*>(arena.allocate(1000, 16));
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(large) % 16, 0);
+    std::fill(large, large + 1000, 0xA5);
+    ASSERT_GT(arena.capacity(), 1000);
+    ASSERT_GE(arena.used(), 1000 + 64);
+
+    const auto capacity = arena.capacity();
+    arena.reset();
+    ASSERT_EQ(arena.used(), 0);
+    ASSERT_EQ(arena.allocate(3, 1), first);
+
+    // Blocks are reused after a reset.
+    auto counter = AllocationCounter();
+    arena.allocate(1000, 16);
+    ASSERT_EQ(counter.allocations(), 0);
+    ASSERT_EQ(arena.capacity(), capacity);
+}
+
+TEST(Arena, Allocator) {
+    Arena arena;
+    auto values = std::vector<uint64_t, ArenaAllocator<uint64_t>>(ArenaAllocator<uint64_t>(arena));
+    for (uint64_t i = 0; i < 1000; i += 1) {
+        values.push_back(i);
+    }
+    ASSERT_EQ(values[999], 999);
+    ASSERT_GE(arena.used(), 1000 * sizeof(uint64_t));
+}
+
+static void expectArenaBuild(Signer& signer) {
+    Arena arena(256);
+    const auto expected = signer.build();
+    ASSERT_FALSE(expected.empty());
+    ASSERT_EQ(hex(signer.build(arena)), hex(expected));
+
+    // Once the arena has grown, building again does not touch the heap.
+    arena.reset();
+    auto counter = AllocationCounter();
+    const auto transaction = signer.build(arena);
+    ASSERT_EQ(counter.allocations(), 0);
+    ASSERT_EQ(hex(transaction), hex(expected));
+
+    signer.publicKey = PublicKey(parse_hex("029729a52e4e3c2b4a4e52aa74033eedaf8ba1df5ab6d1f518fd69e67bbd309b0e"));
+    ASSERT_EQ(hex(signer.build(arena)), hex(signer.build()));
+}
+
+TEST(Arena, SignerBuildEncodedOrders) {
+    auto order = Messages::NewOrder();
+    order.sender = arenaKeyhash;
+    order.id = "B6561DCC104130059A7C08F48C64610C1F6F9064-11";
+    order.symbol = "BTC-5C4_BNB";
+    order.ordertype = 2;
+    order.side = 1;
+    order.price = 100000000;
+    order.quantity = 1200000000;
+    order.timeinforce = 1;
+
+    auto cancel = Messages::CancelOrder();
+    cancel.symbol = "BTC-5C4_BNB";
+    cancel.refid = "B6561DCC104130059A7C08F48C64610C1F6F9064-10";
+
+    auto freeze = Messages::TokenFreeze();
+    freeze.from = arenaKeyhash;
+    freeze.symbol = "ABC-123";
+    freeze.amount = 100000000;
+
+    auto unfreeze = Messages::TokenUnfreeze();
+    unfreeze.from = arenaKeyhash;
+    unfreeze.symbol = "ABC-123";
+    unfreeze.amount = 100000000;
+
+    auto send = Messages::Send();
+    send.inputs.push_back({arenaKeyhash, {{"BNB", 1001000000}}});
+    send.outputs.push_back({arenaKeyhash, {{"BNB", 1001000000}}});
+
+    const auto encodedOrders = std::vector<Data>{
+        Messages::encodeOrder(order),
+        Messages::encodeOrder(cancel),
+        Messages::encodeOrder(freeze),
+        Messages::encodeOrder(unfreeze),
+        Messages::encodeOrder(send),
+    };
+    for (const auto& encoded : encodedOrders) {
+        auto signer = Signer(encoded);
+        signer.accountNumber = 19;
+        signer.sequence = 300;
+        signer.memo = "test";
+        signer.source = -1;
+        signer.privateKey = PrivateKey(parse_hex("95949f757db1f57ca94a5dff23314accbe7abee89597bf6a3c7382c84d7eb832"));
+        expectArenaBuild(signer);
+    }
+}
+
+#ifndef BINANCE_NO_PROTOBUF
+TEST(Arena, SignerBuildNewOrder) {
+    auto order = NewOrder();
+    order.set_sender(arenaKeyhash.data(), arenaKeyhash.size());
+    order.set_id("B6561DCC104130059A7C08F48C64610C1F6F9064-11");
+    order.set_symbol("BTC-5C4_BNB");
+    order.set_ordertype(2);
+    order.set_side(1);
+    order.set_price(100000000);
+    order.set_quantity(1200000000);
+    order.set_timeinforce(1);
+    auto signer = Signer(order);
+    signer.accountNumber = 1;
+    signer.sequence = 10;
+    signer.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
+    expectArenaBuild(signer);
+}
+
+TEST(Arena, SignerBuildOtherOrders) {
+    auto cancel = CancelOrder();
+    cancel.set_symbol("BTC-5C4_BNB");
+    cancel.set_refid("B6561DCC104130059A7C08F48C64610C1F6F9064-10");
+
+    auto freeze = TokenFreeze();
+    freeze.set_from(arenaKeyhash.data(), arenaKeyhash.size());
+    freeze.set_symbol("ABC-123");
+    freeze.set_amount(100000000);
+
+    auto unfreeze = TokenUnfreeze();
+    unfreeze.set_from(arenaKeyhash.data(), arenaKeyhash.size());
+    unfreeze.set_symbol("ABC-123");
+    unfreeze.set_amount(100000000);
+
+    auto send = Send();
+    auto input = send.add_inputs();
+    input->set_address(arenaKeyhash.data(), arenaKeyhash.size());
+    auto coin = input->add_coins();
+    coin->set_denom("BNB");
+    coin->set_amount(1001000000);
+    auto output = send.add_outputs();
+    output->set_address(arenaKeyhash.data(), arenaKeyhash.size());
+    output->add_coins()->CopyFrom(*coin);
+
+    for (const ::google::protobuf::Message* order : std::vector<const ::google::protobuf::Message*>{&cancel, &freeze, &unfreeze, &send}) {
+        auto signer = Signer(*order);
+        signer.accountNumber = 19;
+        signer.sequence = 300;
+        signer.memo = "test";
+        signer.source = -1;
+        signer.privateKey = PrivateKey(parse_hex("95949f757db1f57ca94a5dff23314accbe7abee89597bf6a3c7382c84d7eb832"));
+        expectArenaBuild(signer);
+    }
+}
+#endif
+
+TEST(Arena, SignerBuildInvalidPreimage) {
+    // Raw key hash bytes are not valid UTF-8, so there is no JSON preimage.
+    auto order = Messages::CancelOrder();
+    order.sender = arenaKeyhash;
+    order.symbol = "BTC-5C4_BNB";
+    const auto encoded = Messages::encodeOrder(order);
+    auto signer = Signer(encoded);
+    signer.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
+    Arena arena;
+    ASSERT_TRUE(signer.build(arena).empty());
+}
+
+} // namespace
@@ -0,0 +1,136 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Decoder.h"
+#include "HexCoding.h"
+#include "Messages.h"
+#include "Signer.h"
+
+#include <gtest/gtest.h>
+
+namespace Binance {
+
+static const auto privateKey = parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9");
+
+static std::string str(StringSpan text) {
+    return to_string(text);
+}
+
+/// A new order and a cancel signed together, as built by `TransactionBuilder`.
+static Data buildOrders() {
+    return parse_hex(
+        "a302""f0625dee"
+        "0a65""ce6dc043"
+            "0a14""b6561dcc104130059a7c08f48c64610c1f6f9064"
+            "122b""423635363144434331303431333030353941374330384634384336343631304331463646393036342d3131"
+            "1a0b""4254432d3543345f424e42"
+            "2002""2801""3080c2d72f""3880989abc04""4001"
+        "0a3e""166e681b"
+            "120b""4254432d3543345f424e42"
+            "1a2b""423635363144434331303431333030353941374330384634384336343631304331463646393036342d3130"
+        "126e"
+            "0a26""eb5ae987""21029729a52e4e3c2b4a4e52aa74033eedaf8ba1df5ab6d1f518fd69e67bbd309b0e"
+            "1240""84e924f35a8916da4c95468a4101b42fbe083c114dc8952ed9cabab31e95651370ad05bc3a20d49fd987246d28c2248a3198667d74620a314ec14ec33140a20c"
+            "1801""200a"
+        "1a04""6d656d6f"
+        "2002");
+}
+
+TEST(Decoder, Orders) {
+    const auto transaction = buildOrders();
+    Amino::TransactionView view;
+    ASSERT_TRUE(Amino::decodeTransaction(transaction, view));
+    ASSERT_EQ(view.encoded.size(), transaction.size());
+    ASSERT_EQ(str(view.memo), "memo");
+    ASSERT_EQ(view.source, 2);
+    ASSERT_TRUE(view.data.empty());
+
+    ASSERT_EQ(view.msgs.size(), 2);
+    auto msg = view.msgs.begin();
+    ASSERT_EQ(msg->type, Amino::MessageView::Type::newOrder);
+    Amino::NewOrderView order;
+    ASSERT_TRUE(Amino::NewOrderView::decode(msg->body, order));
+    ASSERT_EQ(hex(order.sender.begin(), order.sender.end()), "b6561dcc104130059a7c08f48c64610c1f6f9064");
+    ASSERT_EQ(str(order.id), "B6561DCC104130059A7C08F48C64610C1F6F9064-11");
+    ASSERT_EQ(str(order.symbol), "BTC-5C4_BNB");
+    ASSERT_EQ(order.ordertype, 2);
+    ASSERT_EQ(order.side, 1);
+    ASSERT_EQ(order.price, 100000000);
+    ASSERT_EQ(order.quantity, 1200000000);
+    ASSERT_EQ(order.timeinforce, 1);
+
+    ++msg;
+    ASSERT_EQ(msg->type, Amino::MessageView::Type::cancelOrder);
+    Amino::CancelOrderView cancel;
+    ASSERT_TRUE(Amino::CancelOrderView::decode(msg->body, cancel));
+    ASSERT_EQ(str(cancel.refid), "B6561DCC104130059A7C08F48C64610C1F6F9064-10");
+    ASSERT_TRUE(++msg == view.msgs.end());
+
+    ASSERT_EQ(view.signatures.size(), 1);
+    const auto signature = *view.signatures.begin();
+    ASSERT_EQ(hex(signature.publicKey.begin(), signature.publicKey.end()), "029729a52e4e3c2b4a4e52aa74033eedaf8ba1df5ab6d1f518fd69e67bbd309b0e");
+    ASSERT_EQ(signature.signature.size(), 64);
+    ASSERT_EQ(signature.accountNumber, 1);
+    ASSERT_EQ(signature.sequence, 10);
+
+    // The views point into the input.
+    ASSERT_GE(order.symbol.data(), reinterpret_cast<const char*>(transaction.data()));
+    ASSERT_LT(order.symbol.data(), reinterpret_cast<const char*>(transaction.data() + transaction.size()));
+}
+
+TEST(Decoder, Send) {
+    auto order = Messages::Send();
+    order.inputs.push_back({parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064"), {{"ABC-123", 5}, {"BNB", 300}}});
+    order.outputs.push_back({parse_hex("88b37d5e05f3699e2a1406468e5d87cb9dcceb00"), {{"BNB", 100}}});
+    order.outputs.push_back({parse_hex("88b37d5e05f3699e2a1406468e5d87cb9dcceb01"), {{"ABC-123", 5}, {"BNB", 200}}});
+    const auto encoded = Messages::encodeOrder(order);
+    auto signer = Signer(encoded);
+    signer.privateKey = PrivateKey(privateKey);
+    const auto transaction = signer.build();
+
+    Amino::TransactionView view;
+    ASSERT_TRUE(Amino::decodeTransaction(transaction, view));
+    ASSERT_EQ(view.msgs.size(), 1);
+    ASSERT_EQ(view.msgs.begin()->type, Amino::MessageView::Type::send);
+    Amino::SendView send;
+    ASSERT_TRUE(Amino::SendView::decode(view.msgs.begin()->body, send));
+    ASSERT_EQ(send.inputs.size(), 1);
+    ASSERT_EQ(send.outputs.size(), 2);
+
+    std::vector<std::string> coins;
+    for (const auto& output : send.outputs) {
+        for (const auto& token : output.coins) {
+            coins.push_back(hex(output.address.begin(), output.address.end()).substr(38) + ":" + str(token.denom) + ":" + std::to_string(token.amount));
+        }
+    }
+    ASSERT_EQ(coins, std::vector<std::string>({ "00:BNB:100", "01:ABC-123:5", "01:BNB:200" }));
+}
+
+TEST(Decoder, RejectsMalformed) {
+    const auto transaction = buildOrders();
+    Amino::TransactionView view;
+    for (size_t size = 0; size < transaction.size(); size += 1) {
+        ASSERT_FALSE(Amino::decodeTransaction(ByteSpan(transaction.data(), size), view)) << size;
+    }
+
+    auto corrupted = transaction;
+    corrupted[2] ^= 0xFF;
+    ASSERT_FALSE(Amino::decodeTransaction(corrupted, view));
+
+    // Amino prefix of the first message.
+    corrupted = transaction;
+    corrupted[2 + 4 + 2] ^= 0xFF;
+    ASSERT_FALSE(Amino::decodeTransaction(corrupted, view));
+
+    // Trailing data after the transaction is left alone.
+    auto padded = transaction;
+    padded.push_back(0);
+    ASSERT_TRUE(Amino::decodeTransaction(padded, view));
+    ASSERT_EQ(view.encoded.size(), transaction.size());
+}
+
+} // namespace
@@ -0,0 +1,120 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Data.h"
+#include "HexCoding.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/secp256k1.h"
+
+#include <gtest/gtest.h>
+
+#include <stdint.h>
+#include <vector>
+
+namespace Binance {
+
+static const auto ecdhPrivateKeyA = parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9");
+static const auto ecdhPrivateKeyB = parse_hex("95949f757db1f57ca94a5dff23314accbe7abee89597bf6a3c7382c84d7eb832");
+static const auto ecdhPublicKeyA = parse_hex("029729a52e4e3c2b4a4e52aa74033eedaf8ba1df5ab6d1f518fd69e67bbd309b0e");
+static const auto ecdhPublicKeyB = parse_hex("026a35920088d98c3888ca68c53dfc93f4564602606cbb87f0fe5ee533db38e502");
+static const auto ecdhSharedX = std::string("55dc105155d85b8971afb7577cc01e9b88f55e606739ef3b7fd6807f015b9b33");
+
+TEST(Ecdh, Multiply) {
+    auto session = Data(65);
+    ASSERT_EQ(ecdh_multiply(&secp256k1, ecdhPrivateKeyA.data(), ecdhPublicKeyB.data(), session.data()), 0);
+    ASSERT_EQ(hex(session), "04" + ecdhSharedX + "624743c30ceb61c9a39d18f0a6b8e8a9b5f6fa2e5106a8c7a0a89a716f815153");
+
+    ASSERT_EQ(ecdh_multiply(&secp256k1, ecdhPrivateKeyB.data(), ecdhPublicKeyA.data(), session.data()), 0);
+    ASSERT_EQ(hex(session).substr(2, 64), ecdhSharedX);
+}
+
+TEST(Ecdh, MultiplyX) {
+    auto sessionX = Data(32);
+    ASSERT_EQ(ecdh_multiply_x(&secp256k1, ecdhPrivateKeyA.data(), ecdhPublicKeyB.data(), sessionX.data()), 0);
+    ASSERT_EQ(hex(sessionX), ecdhSharedX);
+    ASSERT_EQ(ecdh_multiply_x(&secp256k1, ecdhPrivateKeyB.data(), ecdhPublicKeyA.data(), sessionX.data()), 0);
+    ASSERT_EQ(hex(sessionX), ecdhSharedX);
+
+    // (n - 1) * P = -P has the same x-coordinate.
+    const auto orderMinusOne = parse_hex("fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364140");
+    ASSERT_EQ(ecdh_multiply_x(&secp256k1, orderMinusOne.data(), ecdhPublicKeyB.data(), sessionX.data()), 0);
+    ASSERT_EQ(hex(sessionX), hex(ecdhPublicKeyB).substr(2));
+}
+
+TEST(Ecdh, LadderMatchesWindowedMultiply) {
+    auto scalar = Data(32);
+    auto session = Data(65);
+    auto sessionX = Data(32);
+    for (int i = 0; i < 16; i += 1) {
+        // Sparse, dense and random-looking scalars.
+        for (size_t j = 0; j < scalar.size(); j += 1) {
+            scalar[j] = static_cast<byte>(i % 3 == 0 ? (j == 31 ? i + 1 : 0) : (i % 3 == 1 ? 0x7f : j * 37 + i * 11));
+        }
+        ASSERT_EQ(ecdh_multiply(&secp256k1, scalar.data(), ecdhPublicKeyA.data(), session.data()), 0);
+        ASSERT_EQ(ecdh_multiply_x(&secp256k1, scalar.data(), ecdhPublicKeyA.data(), sessionX.data()), 0);
+        ASSERT_EQ(hex(sessionX), hex(session).substr(2, 64)) << i;
+    }
+}
+
+TEST(Ecdh, InvalidInput) {
+    auto session = Data(65);
+    auto sessionX = Data(32);
+    const auto zero = Data(32);
+    const auto order = parse_hex("fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141");
+    for (const auto& scalar : {zero, order}) {
+        ASSERT_EQ(ecdh_multiply(&secp256k1, scalar.data(), ecdhPublicKeyB.data(), session.data()), 1);
+        ASSERT_EQ(ecdh_multiply_x(&secp256k1, scalar.data(), ecdhPublicKeyB.data(), sessionX.data()), 1);
+    }
+
+    // x = 5 is not on the curve.
+    auto notOnCurve = Data(33);
+    notOnCurve[0] = 0x02;
+    notOnCurve[32] = 5;
+    ASSERT_EQ(ecdh_multiply(&secp256k1, ecdhPrivateKeyA.data(), notOnCurve.data(), session.data()), 1);
+    ASSERT_EQ(ecdh_multiply_x(&secp256k1, ecdhPrivateKeyA.data(), notOnCurve.data(), sessionX.data()), 1);
+}
+
+TEST(Ecdh, MultiplyXBatch) {
+    // Counterparties i * G for i = 1...70, so the shared secrets are (a * i) * G.
+    const size_t count = 70;
+    auto publicKeys = Data(33 * count);
+    auto scalar = Data(32);
+    for (size_t i = 0; i < count; i += 1) {
+        scalar[31] = static_cast<byte>(i + 1);
+        ecdsa_get_public_key33(&secp256k1, scalar.data(), publicKeys.data() + 33 * i);
+    }
+    // Spans two chunks and includes an invalid key.
+    publicKeys[33 * 5] = 0x05;
+
+    auto sessionXs = Data(32 * count, 0xff);
+    auto results = std::vector<int>(count, -1);
+    ASSERT_EQ(ecdh_multiply_x_batch(&secp256k1, ecdhPrivateKeyA.data(), publicKeys.data(), count, sessionXs.data(), results.data()), count - 1);
+
+    ASSERT_EQ(results[5], 1);
+    ASSERT_EQ(hex(sessionXs.begin() + 32 * 5, sessionXs.begin() + 32 * 6), hex(Data(32)));
+
+    auto sessionX = Data(32);
+    for (size_t i = 0; i < count; i += 1) {
+        if (i == 5) {
+            continue;
+        }
+        ASSERT_EQ(results[i], 0);
+        ASSERT_EQ(ecdh_multiply_x(&secp256k1, ecdhPrivateKeyA.data(), publicKeys.data() + 33 * i, sessionX.data()), 0);
+        ASSERT_EQ(hex(sessionXs.begin() + 32 * i, sessionXs.begin() + 32 * (i + 1)), hex(sessionX)) << i;
+    }
+    ASSERT_EQ(hex(sessionXs.begin(), sessionXs.begin() + 32), hex(ecdhPublicKeyA).substr(2));
+    ASSERT_EQ(hex(sessionXs.begin() + 32, sessionXs.begin() + 64), "8fe65c37e5691a3746c6880359edc4b5ec8c747baf8a2dae837ffb507b02ee20");
+    ASSERT_EQ(hex(sessionXs.begin() + 32 * 64, sessionXs.begin() + 32 * 65), "2db7d6fdb097a5a448bdaf1af443278f1820e0e8bc5cdc327e93e13827639afd");
+    ASSERT_EQ(hex(sessionXs.begin() + 32 * 69, sessionXs.end()), "ee8f413c6b33abf6162b7624a98010c37b4f937dbe6d9482d174bccebc536149");
+
+    // An invalid private key fails every counterparty.
+    ASSERT_EQ(ecdh_multiply_x_batch(&secp256k1, Data(32).data(), publicKeys.data(), count, sessionXs.data(), results.data()), 0);
+    ASSERT_EQ(results[0], 1);
+}
+
+} // namespace
@@ -0,0 +1,147 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Address.h"
+#include "Amino.h"
+#include "Bech32.h"
+#include "HexCoding.h"
+#include "Messages.h"
+
+#include "dex.pb.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace Binance {
+
+TEST(Encoding, Bech32DecodeIntoBuffers) {
+    const auto text = std::string("bnb1hgm0p7khfk85zpz5v0j8wnej3a90w709vhkdfu");
+    auto hrp = std::string();
+    byte values[Bech32::maxLength];
+    size_t size;
+    ASSERT_TRUE(Bech32::decode(StringSpan(text), hrp, values, size));
+    ASSERT_EQ(hrp, "bnb");
+    ASSERT_EQ(size, 32);
+
+    const auto decoded = Bech32::decode(text);
+    ASSERT_EQ(decoded.first, hrp);
+    ASSERT_EQ(decoded.second, Data(values, values + size));
+    ASSERT_EQ(Bech32::encode(hrp, ByteSpan(values, size)), text);
+
+    // Decoding a view of a longer buffer only reads the viewed characters.
+    const auto padded = text + "qqqq";
+    ASSERT_TRUE(Bech32::decode(StringSpan(padded.data(), text.size()), hrp, values, size));
+
+    byte keyHash[20];
+    auto end = keyHash;
+    ASSERT_TRUE((Bech32::convertBits<5, 8, false>(end, ByteSpan(values, size))));
+    ASSERT_EQ(end, keyHash + 20);
+    ASSERT_EQ(hex(keyHash), "ba36f0fad74d8f41045463e4774f328f4af779e5");
+}
+
+static bool decodes(const std::string& text) {
+    auto hrp = std::string();
+    byte values[Bech32::maxLength];
+    size_t size;
+    return Bech32::decode(StringSpan(text), hrp, values, size);
+}
+
+TEST(Encoding, Bech32Invalid) {
+    ASSERT_TRUE(decodes("BNB1HGM0P7KHFK85ZPZ5V0J8WNEJ3A90W709VHKDFU"));
+    ASSERT_FALSE(decodes("bnb1hgm0p7khfk85zpz5v0j8wnej3a90w709vhkdfv"));
+    ASSERT_FALSE(decodes("Bnb1hgm0p7khfk85zpz5v0j8wnej3a90w709vhkdfu"));
+    ASSERT_FALSE(decodes("bnb1qqqqq"));
+    ASSERT_FALSE(decodes("1qqqqqqqq"));
+    ASSERT_FALSE(decodes(std::string(91, 'q')));
+}
+
+TEST(Encoding, AddressViews) {
+    const auto text = Address(Address::binanceTestHRP, parse_hex("ba36f0fad74d8f41045463e4774f328f4af779e5")).encode();
+    const auto result = Address::decode(StringSpan(text));
+    ASSERT_TRUE(result.second);
+    ASSERT_EQ(result.first.hrp, "tbnb");
+    ASSERT_EQ(hex(result.first.keyHash), "ba36f0fad74d8f41045463e4774f328f4af779e5");
+    ASSERT_FALSE(Address::decode(StringSpan(text.data(), text.size() - 1)).second);
+}
+
+TEST(Encoding, AminoWrapMessage) {
+    auto order = CancelOrder();
+    order.set_symbol("BTC-5C4_BNB");
+    order.set_refid("B6561DCC104130059A7C08F48C64610C1F6F9064-10");
+    const auto prefix = parse_hex("166e681b");
+    for (auto prefixWithSize : {false, true}) {
+        ASSERT_EQ(Amino::wrap(order, prefix, prefixWithSize), Amino::wrap(order.SerializeAsString(), prefix, prefixWithSize));
+    }
+    ASSERT_EQ(Amino::encodeOrder(order), Amino::wrap(order.SerializeAsString(), prefix, false));
+}
+
+TEST(Encoding, MessagesMatchGeneratedClasses) {
+    const auto sender = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+
+    auto order = NewOrder();
+    order.set_sender(sender.data(), sender.size());
+    order.set_id("B6561DCC104130059A7C08F48C64610C1F6F9064-11");
+    order.set_symbol("BTC-5C4_BNB");
+    order.set_ordertype(2);
+    order.set_side(2);
+    order.set_price(-5);
+    order.set_quantity(1LL << 62);
+    auto message = Messages::NewOrder();
+    message.sender = sender;
+    message.id = order.id();
+    message.symbol = order.symbol();
+    message.ordertype = 2;
+    message.side = 2;
+    message.price = -5;
+    message.quantity = 1LL << 62;
+    ASSERT_EQ(hex(Messages::encodeOrder(message)), hex(Amino::encodeOrder(order)));
+
+    auto send = Send();
+    auto sendMessage = Messages::Send();
+    for (int i = 0; i < 3; i += 1) {
+        auto input = send.add_inputs();
+        input->set_address(sender.data(), sender.size());
+        sendMessage.inputs.push_back({sender, {}});
+        for (int j = 0; j <= i; j += 1) {
+            auto coin = input->add_coins();
+            coin->set_denom(j == 0 ? "" : "BNB");
+            coin->set_amount(j * 1000);
+            sendMessage.inputs.back().coins.push_back({coin->denom(), coin->amount()});
+        }
+    }
+    send.add_outputs();
+    sendMessage.outputs.emplace_back();
+    ASSERT_EQ(hex(Messages::encodeOrder(sendMessage)), hex(Amino::encodeOrder(send)));
+
+    auto cancel = CancelOrder();
+    cancel.set_refid("B6561DCC104130059A7C08F48C64610C1F6F9064-10");
+    auto cancelMessage = Messages::CancelOrder();
+    cancelMessage.refid = cancel.refid();
+    ASSERT_EQ(hex(Messages::encodeOrder(cancelMessage)), hex(Amino::encodeOrder(cancel)));
+
+    auto unfreeze = TokenUnfreeze();
+    unfreeze.set_from(sender.data(), sender.size());
+    unfreeze.set_amount(100000000);
+    auto unfreezeMessage = Messages::TokenUnfreeze();
+    unfreezeMessage.from = sender;
+    unfreezeMessage.amount = 100000000;
+    ASSERT_EQ(hex(Messages::encodeOrder(unfreezeMessage)), hex(Amino::encodeOrder(unfreeze)));
+
+    auto signature = Signature64();
+    signature[0] = 1;
+    auto transaction = Transaction();
+    const auto encodedSignature = Amino::encodeSignature(PublicKey(), signature, 7, 0);
+    const auto msg = Amino::encodeOrder(cancel);
+    transaction.add_msgs(msg.data(), msg.size());
+    transaction.add_signatures(encodedSignature.data(), encodedSignature.size());
+    transaction.set_source(-2);
+    ASSERT_EQ(hex(Amino::encodeTransaction(Span<const Data>(&msg, 1), encodedSignature, "", -2)),
+        hex(Amino::wrap(transaction.SerializeAsString(), Amino::transactionPrefix, true)));
+}
+
+} // namespace
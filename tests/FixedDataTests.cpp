@@ -0,0 +1,62 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Address.h"
+#include "Bech32.h"
+#include "FixedData.h"
+#include "HexCoding.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace Binance {
+
+static_assert(sizeof(KeyHash) == 20 && sizeof(PrivateKey) == 32 && sizeof(Signature64) == 64, "Storage is inline");
+static_assert(std::is_trivially_copyable<PublicKey>::value, "Keys copy as plain bytes");
+static_assert(!std::is_convertible<Data, PrivateKey>::value, "Conversions that can throw are explicit");
+
+TEST(FixedData, DataConversion) {
+    const auto data = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+    const auto keyHash = KeyHash(data);
+    ASSERT_EQ(hex(keyHash), "b6561dcc104130059a7c08f48c64610c1f6f9064");
+    ASSERT_TRUE(keyHash == data);
+    ASSERT_TRUE(data == keyHash);
+    ASSERT_EQ(static_cast<Data>(keyHash), data);
+    ASSERT_EQ(KeyHash(data.data()), keyHash);
+
+    ASSERT_THROW(KeyHash(Data(19)), std::invalid_argument);
+    ASSERT_THROW(KeyHash(Data{}), std::invalid_argument);
+    ASSERT_TRUE(keyHash != Data(21));
+}
+
+TEST(FixedData, Zero) {
+    auto signature = Signature64();
+    ASSERT_TRUE(signature.isZero());
+    signature[63] = 1;
+    ASSERT_FALSE(signature.isZero());
+    ASSERT_TRUE(Signature64() < signature);
+}
+
+TEST(FixedData, AddressKeyHashSize) {
+    const auto address = Address::decode("bnb1hgm0p7khfk85zpz5v0j8wnej3a90w709vhkdfu");
+    ASSERT_TRUE(address.second);
+    ASSERT_EQ(hex(address.first.keyHash), "ba36f0fad74d8f41045463e4774f328f4af779e5");
+    ASSERT_EQ(address.first.encode(), "bnb1hgm0p7khfk85zpz5v0j8wnej3a90w709vhkdfu");
+    ASSERT_EQ(Address("cosmos", address.first.keyHash).encode(), "");
+
+    // Valid Bech32 with a 32-byte payload, which is not a Binance address.
+    const auto program = Data(32, 1);
+    char encoded[Bech32::encodedSize(3, 32)];
+    const auto size = Bech32::encode("bnb", 3, program.data(), program.size(), encoded);
+    ASSERT_FALSE(Address::decode(std::string(encoded, size)).second);
+    ASSERT_THROW(Address(Address::binanceHRP, Data(32)), std::invalid_argument);
+}
+
+} // namespace
@@ -0,0 +1,172 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HDWallet.h"
+#include "HexCoding.h"
+#include "crypto/bip32.h"
+#include "crypto/pbkdf2.h"
+#include "crypto/sha2.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace Binance {
+
+static const auto walletMnemonic = std::string("abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about");
+
+TEST(HDWallet, MnemonicSeed) {
+    ASSERT_EQ(hex(HDWallet::mnemonicSeed(walletMnemonic, "TREZOR")),
+        "c55257c360c07c72029aebc1b53c05ed0362ada38ead3e3e9efa3708e53495531f09a6987599d18264c1e1c92f2cf141630c7a3c4ab7c81b2f001698e7463b04");
+    ASSERT_EQ(hex(HDWallet::mnemonicSeed(walletMnemonic)),
+        "5eb00bbddcf069084889a8ab9155568165f5c453ccb85e70811aaed6f6da5fc19a5ac40b389cd370d086206dec8aa6c43daea6690f20ad3d8d48b2d2ce9e38e4");
+}
+
+TEST(HDWallet, Pbkdf2) {
+    const auto password = std::string("passwd");
+    const auto salt = std::string("salt");
+    uint8_t key[64];
+    pbkdf2_hmac_sha512(reinterpret_cast<const uint8_t*>(password.data()), 6, reinterpret_cast<const uint8_t*>(salt.data()),
+        4, 1, key, sizeof(key));
+    ASSERT_EQ(hex(key, key + sizeof(key)), "c74319d99499fc3e9013acff597c23c5baf0a0bec5634c46b8352b793e324723d55caa76b2b25c43402dcfdc06cdcf66f95b7d0429420b39520006749c51a04e");
+
+    // Keys longer than a digest.
+    uint8_t longKey[100];
+    pbkdf2_hmac_sha512(reinterpret_cast<const uint8_t*>(password.data()), 6, reinterpret_cast<const uint8_t*>(salt.data()),
+        4, 3, longKey, sizeof(longKey));
+    ASSERT_EQ(hex(longKey, longKey + sizeof(longKey)), 
+        "2ad6a1074a28addf332db771afaa5928b0bebc600f287167c366a1d730f8835f94e70d2d478279cdc0dae70e154cc5fb0442760e84694adb85f6aa1db4e7807c1686b79e5ff860059abe3ca7bfde057bfed883537f964a806b4d2fc9f87739082f247df9");
+}
+
+TEST(HDWallet, MnemonicSeeds) {
+    auto mnemonics = std::vector<std::string>();
+    for (size_t i = 0; i < 2 * SHA512_LANES + 1; i += 1) {
+        mnemonics.push_back(walletMnemonic + std::string(i, ' '));
+    }
+    const auto seeds = HDWallet::mnemonicSeeds(mnemonics, "TREZOR", 2);
+    ASSERT_EQ(seeds.size(), mnemonics.size());
+    ASSERT_EQ(hex(seeds[0]),
+        "c55257c360c07c72029aebc1b53c05ed0362ada38ead3e3e9efa3708e53495531f09a6987599d18264c1e1c92f2cf141630c7a3c4ab7c81b2f001698e7463b04");
+    for (size_t i = 0; i < mnemonics.size(); i += 1) {
+        ASSERT_EQ(seeds[i], HDWallet::mnemonicSeed(mnemonics[i], "TREZOR"));
+    }
+    ASSERT_TRUE(HDWallet::mnemonicSeeds({}).empty());
+}
+
+TEST(HDWallet, Bip32Vector) {
+    const auto seed = parse_hex("000102030405060708090a0b0c0d0e0f");
+    HDWallet wallet(seed);
+
+    HDNode node;
+    ASSERT_TRUE(wallet.derive(Span<const uint32_t>(), node));
+    ASSERT_EQ(hex(node.private_key, node.private_key + 32), "e8f32e723decf4051aefac8e2c93c9c5b214313817cdb01a1494b917c8436b35");
+    ASSERT_EQ(hex(node.chain_code, node.chain_code + 32), "873dff81c02f525623fd1fe5167eac3a55a049de3d314bb42ee227ffed37d508");
+
+    const auto path = std::vector<uint32_t>{0 | HDWallet::hardened, 1, 2 | HDWallet::hardened, 2, 1000000000};
+    ASSERT_TRUE(wallet.derive(path, node));
+    ASSERT_EQ(node.depth, 5);
+    ASSERT_EQ(hex(node.private_key, node.private_key + 32), "471b76e389e528d6de6d816857e012c5455051cad6660850e58372a6c3e6e7c8");
+    ASSERT_EQ(hex(node.chain_code, node.chain_code + 32), "c783e67b921d2beb8f6b389cc646d7263b4145701dadd2161548a8b078e65e9e");
+    ASSERT_EQ(wallet.cachedNodes(), 4);
+
+    const auto shortSeed = Data(15);
+    ASSERT_THROW(HDWallet wallet(shortSeed), std::invalid_argument);
+}
+
+TEST(HDWallet, BinancePath) {
+    HDWallet wallet(walletMnemonic, "");
+    ASSERT_EQ(hex(wallet.privateKey(0)), "3955f430d8372b601f3a70c10a707f94c509fb3c51c1e94ddbb7ab9906cb659d");
+    ASSERT_EQ(wallet.cachedNodes(), 4);
+
+    // Cached ancestors are found again instead of derived anew.
+    HDNode account;
+    const auto accountPath = std::vector<uint32_t>{44 | HDWallet::hardened, 714 | HDWallet::hardened, 1 | HDWallet::hardened};
+    ASSERT_TRUE(wallet.derive(accountPath, account));
+    ASSERT_EQ(wallet.cachedNodes(), 4);
+
+    // Further keys of the account start from the cached parent.
+    ASSERT_EQ(hex(wallet.privateKey(1)), "211c108b0b37b40411f7e033357c66b4fc63915ed99014e1a59959b265cfff85");
+    ASSERT_EQ(hex(wallet.privateKey(1000)), "5b9ce59f8af31925ca3bb6eaac12f64a77ebf3af51bde5589ea4be0c2b060007");
+    ASSERT_EQ(wallet.cachedNodes(), 4);
+
+    // Other accounts share the first two levels.
+    ASSERT_EQ(hex(wallet.privateKey(7, 3)), "899dfc0f7a16b34411983bc403716352cfdd5d197befda8e76215c6d863644d1");
+    ASSERT_EQ(wallet.cachedNodes(), 6);
+
+    HDNode node;
+    const auto path = std::vector<uint32_t>{44 | HDWallet::hardened, 714 | HDWallet::hardened, 0 | HDWallet::hardened, 0, 2};
+    ASSERT_TRUE(wallet.derive(path, node));
+    ASSERT_EQ(hex(node.private_key, node.private_key + 32), "95c6e3efdd1e678c0da7600f94485a27b0d60801fcc689c72fb57a0871e0b560");
+
+    ASSERT_THROW(wallet.privateKey(HDWallet::hardened), std::invalid_argument);
+    ASSERT_THROW(wallet.privateKey(0, HDWallet::hardened), std::invalid_argument);
+}
+
+TEST(HDWallet, DeriveRange) {
+    HDWallet wallet(walletMnemonic, "");
+    const auto keys = wallet.deriveRange(0, 1001, 0, 4);
+    ASSERT_EQ(keys.size(), 1001);
+    ASSERT_EQ(hex(keys[2]), "95c6e3efdd1e678c0da7600f94485a27b0d60801fcc689c72fb57a0871e0b560");
+    ASSERT_EQ(hex(keys[1000]), "5b9ce59f8af31925ca3bb6eaac12f64a77ebf3af51bde5589ea4be0c2b060007");
+    for (uint32_t i = 0; i < keys.size(); i += 97) {
+        ASSERT_EQ(keys[i], wallet.privateKey(i));
+    }
+
+    const auto shifted = wallet.deriveRange(990, 11, 0, 1);
+    ASSERT_EQ(shifted.back(), keys.back());
+    ASSERT_TRUE(wallet.deriveRange(5, 0).empty());
+    ASSERT_THROW(wallet.deriveRange(HDWallet::hardened - 1, 2), std::invalid_argument);
+}
+
+TEST(HDWallet, ExtendedPublicKey) {
+    HDWallet wallet(walletMnemonic, "");
+    const auto account = wallet.extendedPublicKey();
+    ASSERT_EQ(hex(account.publicKey), "02a55c9b80a171819c0085711c9c610611c2057b125fb0794f590d1791069f29e8");
+    ASSERT_EQ(hex(account.chainCode), "0ba3696a860e6e6e2ce07952280c902ddfca8ab12f68f5ce3357817d4d516018");
+
+    // Spans several inversion chunks.
+    const auto external = account.child(0);
+    const auto keys = external.publicKeys(0, 201);
+    ASSERT_EQ(keys.size(), 201);
+    ASSERT_EQ(hex(keys[0]), "02a5c1a09e80070d4f42e4c577b1cd840e12f775b83afd07dc01dde138adf64ea9");
+    ASSERT_EQ(hex(keys[1]), "0203b47d2e334a4d2d5bed60a5e7b9b6651090d9c924520440036c52e3ac393aba");
+    ASSERT_EQ(hex(keys[63]), "03b9cb491d6ebb4ff52b89ee5f1654c216c7450b16aa8f8fb3554192b853b49e75");
+    ASSERT_EQ(hex(keys[64]), "025ab0cd2c5c6cec3013156d7581eb7b2253d5d244c960610362f195fc71ad59a1");
+    ASSERT_EQ(hex(keys[200]), "037ff2a7b4b76a1c60f5a436fc02eabd0ca51ddb35e3b11d5a20543a12d973b96a");
+    ASSERT_EQ(hex(external.child(200).publicKey), hex(keys[200]));
+    ASSERT_EQ(hex(external.publicKeys(64, 1)[0]), hex(keys[64]));
+
+    const auto addresses = external.addresses(63, 2);
+    ASSERT_EQ(addresses[0], "bnb1y98vrcerjrcg9uesenaks379j3u8hnpc96cw6d");
+    ASSERT_EQ(addresses[1], "bnb1epxhltp6qev3a7rwlt7h9xnmp0w8vthrers897");
+
+    ASSERT_TRUE(external.publicKeys(7, 0).empty());
+    ASSERT_THROW(external.publicKeys(HDWallet::hardened - 1, 2), std::invalid_argument);
+    ASSERT_THROW(account.child(HDWallet::hardened), std::invalid_argument);
+}
+
+TEST(HDWallet, PublicBatchResults) {
+    HDWallet wallet(walletMnemonic, "");
+    HDNode node;
+    const auto path = std::vector<uint32_t>{44 | HDWallet::hardened, 714 | HDWallet::hardened, 0 | HDWallet::hardened, 0};
+    ASSERT_TRUE(wallet.derive(path, node));
+    hdnode_fill_public_key(&node);
+
+    // Results are 0 for derived keys, as in the other batch functions, and 1 for hardened indices.
+    auto keys = Data(33 * 3);
+    auto results = std::vector<int>(3, -1);
+    ASSERT_EQ(hdnode_public_ckd_batch(&node, HDWallet::hardened - 2, 3, keys.data(), results.data()), 2);
+    ASSERT_EQ(results, std::vector<int>({0, 0, 1}));
+    ASSERT_EQ(hex(keys.begin() + 66, keys.end()), hex(Data(33)));
+
+    auto child = node;
+    ASSERT_EQ(hdnode_public_ckd(&child, HDWallet::hardened - 1), 1);
+    ASSERT_EQ(hex(keys.begin() + 33, keys.begin() + 66), hex(child.public_key, child.public_key + 33));
+}
+
+} // namespace
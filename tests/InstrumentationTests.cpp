@@ -0,0 +1,108 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HexCoding.h"
+#include "Instrumentation.h"
+#include "Messages.h"
+#include "Signer.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <thread>
+#include <vector>
+
+namespace Binance {
+
+using namespace Instrumentation;
+
+TEST(Instrumentation, Buckets) {
+    for (uint64_t value = 0; value < (uint64_t(1) << 40); value = value * 5 / 4 + 1) {
+        const auto index = Histogram::bucketIndex(value);
+        ASSERT_LT(index, Histogram::bucketCount);
+        ASSERT_GE(Histogram::bucketValue(index), value);
+        ASSERT_LE(Histogram::bucketValue(index), value + value / 32);
+        if (index > 0) {
+            ASSERT_LT(Histogram::bucketValue(index - 1), value);
+        }
+    }
+    ASSERT_EQ(Histogram::bucketIndex(uint64_t(1) << 50), Histogram::bucketCount - 1);
+}
+
+TEST(Instrumentation, Percentiles) {
+    reset();
+    for (uint64_t value = 1; value <= 10000; value += 1) {
+        record(Stage::hash, value);
+    }
+    const auto histogram = snapshot()[Stage::hash];
+    ASSERT_EQ(histogram.count, 10000);
+    ASSERT_EQ(histogram.min, 1);
+    ASSERT_EQ(histogram.max, 10000);
+    ASSERT_EQ(histogram.mean(), 5000.5);
+    ASSERT_NEAR(histogram.percentile(50), 5000, 5000 / 32);
+    ASSERT_NEAR(histogram.percentile(99), 9900, 9900 / 32);
+    ASSERT_EQ(histogram.percentile(100), 10000);
+    ASSERT_EQ(snapshot()[Stage::sign].count, 0);
+
+    const auto json = nlohmann::json::parse(snapshot().json());
+    ASSERT_EQ(json["stages"]["hash"]["count"], 10000);
+    ASSERT_EQ(json["stages"].count("sign"), 0);
+
+    reset();
+    ASSERT_EQ(snapshot()[Stage::hash].count, 0);
+}
+
+TEST(Instrumentation, Threads) {
+    reset();
+    std::vector<std::thread> pool;
+    for (int i = 0; i < 4; i += 1) {
+        pool.emplace_back([i]() {
+            for (uint64_t value = 0; value < 1000; value += 1) {
+                record(Stage::verify, 1000 * i + value);
+            }
+        });
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    // The threads have exited, their samples are kept.
+    const auto histogram = snapshot()[Stage::verify];
+    ASSERT_EQ(histogram.count, 4000);
+    ASSERT_EQ(histogram.min, 0);
+    ASSERT_EQ(histogram.max, 3999);
+}
+
+#ifdef BINANCE_INSTRUMENTATION
+TEST(Instrumentation, SignerStages) {
+    auto order = Messages::NewOrder();
+    order.sender = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+    order.symbol = "BTC-5C4_BNB";
+    const auto encoded = Messages::encodeOrder(order);
+    auto signer = Signer(encoded);
+    signer.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
+
+    reset();
+    ASSERT_FALSE(signer.build().empty());
+    auto stages = snapshot();
+    for (auto stage : {Stage::build, Stage::preimage, Stage::publicKey, Stage::sign, Stage::encode}) {
+        ASSERT_EQ(stages[stage].count, 1) << stageName(stage);
+    }
+    // The preimage is streamed into its hash while it is generated.
+    ASSERT_EQ(stages[Stage::hash].count, 0);
+    ASSERT_GE(stages[Stage::build].max, stages[Stage::sign].max);
+
+    reset();
+    ASSERT_FALSE(signer.sign().isZero());
+    stages = snapshot();
+    for (auto stage : {Stage::preimage, Stage::sign}) {
+        ASSERT_EQ(stages[stage].count, 1) << stageName(stage);
+    }
+    ASSERT_EQ(stages[Stage::hash].count, 0);
+}
+#endif
+
+} // namespace
@@ -0,0 +1,118 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HexCoding.h"
+#include "KeyPairFile.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/secp256k1.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Binance {
+
+/// Key hash computed the slow way, from a full multiplication.
+static KeyHash expectedKeyHash(const PrivateKey& privateKey) {
+    uint8_t publicKey[33];
+    ecdsa_get_public_key33(&secp256k1, privateKey.data(), publicKey);
+    KeyHash keyHash;
+    ecdsa_get_pubkeyhash(publicKey, HASHER_SHA2_RIPEMD, keyHash.data());
+    return keyHash;
+}
+
+TEST(KeyPairFile, GeneratorWalksConsecutiveKeys) {
+    auto base = PrivateKey();
+    base[31] = 1;
+    auto generator = KeyPairGenerator(base);
+
+    // Starts at G, doubles once, and spans several inversion chunks.
+    auto records = std::vector<KeyRecord>(600);
+    generator.generate(records.data(), 100);
+    generator.generate(records.data() + 100, 500);
+    ASSERT_EQ(hex(records[0].privateKey), "0000000000000000000000000000000000000000000000000000000000000001");
+    ASSERT_EQ(hex(records[599].privateKey), "0000000000000000000000000000000000000000000000000000000000000258");
+    ASSERT_EQ(generator.next()[31], 0x59);
+    for (size_t i = 0; i < records.size(); i += 1) {
+        ASSERT_EQ(records[i].keyHash, expectedKeyHash(records[i].privateKey)) << i;
+    }
+}
+
+TEST(KeyPairFile, GeneratorRange) {
+    ASSERT_THROW(KeyPairGenerator(PrivateKey{}), std::invalid_argument);
+    ASSERT_THROW(KeyPairGenerator(PrivateKey(parse_hex("fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141"))),
+        std::invalid_argument);
+
+    // n - 4 leaves room for three keys and the point after them.
+    auto generator = KeyPairGenerator(PrivateKey(parse_hex("fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd036413d")));
+    KeyRecord records[4];
+    ASSERT_THROW(generator.generate(records, 4), std::out_of_range);
+    generator.generate(records, 3);
+    ASSERT_EQ(records[2].keyHash, expectedKeyHash(records[2].privateKey));
+    ASSERT_THROW(generator.generate(records, 1), std::out_of_range);
+
+    auto random = KeyPairGenerator();
+    random.generate(records, 1);
+    ASSERT_EQ(records[0].keyHash, expectedKeyHash(records[0].privateKey));
+}
+
+TEST(KeyPairFile, WriteAndMap) {
+    const auto path = testing::TempDir() + "keys.bin";
+    auto base = PrivateKey();
+    base[0] = 0x42;
+    auto generator = KeyPairGenerator(base);
+    KeyPairFile::write(path, generator, 1000, 3);
+    ASSERT_EQ(hex(generator.next()), "42000000000000000000000000000000000000000000000000000000000003e8");
+
+    {
+        const auto file = KeyPairFile(path);
+        ASSERT_EQ(file.size(), 1000);
+        size_t index = 0;
+        for (const auto& record : file) {
+            auto expected = base;
+            expected[30] = static_cast<byte>(index >> 8);
+            expected[31] = static_cast<byte>(index);
+            ASSERT_EQ(record.privateKey, expected);
+            index += 1;
+        }
+        for (const auto index : {0, 333, 334, 999}) {
+            ASSERT_EQ(file[index].keyHash, expectedKeyHash(file[index].privateKey)) << index;
+        }
+        ASSERT_EQ(file.address(1).encode(), Address(Address::binanceHRP, expectedKeyHash(file[1].privateKey)).encode());
+    }
+
+    KeyPairFile::write(path, 10);
+    ASSERT_EQ(KeyPairFile(path).size(), 10);
+    std::remove(path.c_str());
+}
+
+TEST(KeyPairFile, InvalidFile) {
+    const auto path = testing::TempDir() + "keys-truncated.bin";
+    KeyPairFile::write(path, 4, 1);
+    {
+        std::ifstream in(path, std::ios::binary);
+        auto contents = std::string(std::istreambuf_iterator<char>(in), {});
+        contents.resize(contents.size() - 1);
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << contents;
+    }
+    ASSERT_THROW(KeyPairFile file(path), std::runtime_error);
+
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << "not a key file, but long enough";
+    }
+    ASSERT_THROW(KeyPairFile file(path), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+} // namespace
@@ -0,0 +1,158 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Arena.h"
+#include "HexCoding.h"
+#include "Messages.h"
+#include "Signer.h"
+#include "Verifier.h"
+
+#include <gtest/gtest.h>
+
+namespace Binance {
+
+static Messages::NewOrder messagesNewOrder() {
+    auto order = Messages::NewOrder();
+    order.sender = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+    order.id = "B6561DCC104130059A7C08F48C64610C1F6F9064-11";
+    order.symbol = "BTC-5C4_BNB";
+    order.ordertype = 2;
+    order.side = 1;
+    order.price = 100000000;
+    order.quantity = 1200000000;
+    order.timeinforce = 1;
+    return order;
+}
+
+static Messages::Send messagesSend() {
+    auto order = Messages::Send();
+    order.inputs.push_back({parse_hex("40c2979694bbc961023d1d27be6fc4d21a9febe6"), {{"BNB", 1'001'000'000}}});
+    order.outputs.push_back({parse_hex("88b37d5e05f3699e2a1406468e5d87cb9dcceb95"), {{"BNB", 1'001'000'000}}});
+    return order;
+}
+
+TEST(Messages, EncodeOrders) {
+    ASSERT_EQ(hex(Messages::encodeOrder(messagesNewOrder())),
+        "ce6dc043"
+        "0a14""b6561dcc104130059a7c08f48c64610c1f6f9064"
+        "122b""423635363144434331303431333030353941374330384634384336343631304331463646393036342d3131"
+        "1a0b""4254432d3543345f424e42"
+        "2002"
+        "2801"
+        "3080c2d72f"
+        "3880989abc04"
+        "4001");
+
+    ASSERT_EQ(hex(Messages::encodeOrder(messagesSend())),
+        "2a2c87fa"
+        "0a23""0a1440c2979694bbc961023d1d27be6fc4d21a9febe6120b0a03424e4210c098a8dd03"
+        "1223""0a1488b37d5e05f3699e2a1406468e5d87cb9dcceb95120b0a03424e4210c098a8dd03");
+
+    // Default values are not encoded, negative integers take ten bytes.
+    auto freeze = Messages::TokenFreeze();
+    freeze.symbol = "ABC-123";
+    ASSERT_EQ(hex(Messages::encodeOrder(freeze)), "e774b32d""1207""4142432d313233");
+    auto unfreeze = Messages::TokenUnfreeze();
+    unfreeze.amount = -1;
+    ASSERT_EQ(hex(Messages::encodeOrder(unfreeze)), "6515ff0d""18ffffffffffffffffff01");
+    ASSERT_EQ(hex(Messages::encodeOrder(Messages::CancelOrder())), "166e681b");
+}
+
+TEST(Messages, DecodeOrders) {
+    const auto newOrder = messagesNewOrder();
+    auto encoded = Messages::encodeOrder(newOrder);
+    auto decodedNewOrder = Messages::NewOrder();
+    ASSERT_TRUE(Messages::decodeOrder(encoded, decodedNewOrder));
+    ASSERT_EQ(hex(decodedNewOrder.sender), hex(newOrder.sender));
+    ASSERT_EQ(decodedNewOrder.id, newOrder.id);
+    ASSERT_EQ(decodedNewOrder.symbol, newOrder.symbol);
+    ASSERT_EQ(decodedNewOrder.price, newOrder.price);
+    ASSERT_EQ(decodedNewOrder.quantity, newOrder.quantity);
+    ASSERT_EQ(decodedNewOrder.timeinforce, newOrder.timeinforce);
+
+    const auto send = messagesSend();
+    const auto encodedSend = Messages::encodeOrder(send);
+    auto decodedSend = Messages::Send();
+    ASSERT_TRUE(Messages::decodeOrder(encodedSend, decodedSend));
+    ASSERT_EQ(decodedSend.inputs.size(), 1);
+    ASSERT_EQ(decodedSend.outputs.size(), 1);
+    ASSERT_EQ(decodedSend.outputs[0].coins[0].denom, "BNB");
+    ASSERT_EQ(hex(Messages::encodeOrder(decodedSend)), hex(encodedSend));
+
+    auto cancel = Messages::CancelOrder();
+    cancel.symbol = "BTC-5C4_BNB";
+    cancel.refid = "B6561DCC104130059A7C08F48C64610C1F6F9064-10";
+    const auto encodedCancel = Messages::encodeOrder(cancel);
+    auto decodedCancel = Messages::CancelOrder();
+    ASSERT_TRUE(Messages::decodeOrder(encodedCancel, decodedCancel));
+    ASSERT_EQ(decodedCancel.refid, cancel.refid);
+
+    // Wrong type prefix and truncated fields.
+    auto freeze = Messages::TokenFreeze();
+    ASSERT_FALSE(Messages::decodeOrder(encoded, freeze));
+    encoded.pop_back();
+    ASSERT_FALSE(Messages::decodeOrder(encoded, decodedNewOrder));
+}
+
+TEST(Messages, SignEncodedOrder) {
+    const auto encoded = Messages::encodeOrder(messagesNewOrder());
+    auto signer = Signer(encoded);
+    signer.accountNumber = 1;
+    signer.sequence = 10;
+    signer.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
+
+    // Same transaction as the generated `NewOrder` in the signer tests.
+    const auto transaction = signer.build();
+    ASSERT_EQ(hex(transaction.begin() + transaction.size() - 68, transaction.end() - 4),
+        "2a78b6d9a108eb9440221802b626e24d80179395ac984f016db012ef1a0c16d71b4d7053e05366ae3ea2681fc8052398fda20551c965d74c5970bbc66b94b48e");
+    ASSERT_EQ(hex(signer.sign()), hex(transaction.begin() + transaction.size() - 68, transaction.end() - 4));
+    ASSERT_TRUE(verifyTransaction(transaction.data(), transaction.size()));
+
+    Arena arena;
+    ASSERT_EQ(hex(signer.build(arena)), hex(transaction));
+}
+
+TEST(Messages, SignEncodedSend) {
+    const auto encoded = Messages::encodeOrder(messagesSend());
+    auto signer = Signer(encoded);
+    signer.accountNumber = 19;
+    signer.sequence = 23;
+    signer.memo = "test";
+    signer.source = 1;
+    signer.privateKey = PrivateKey(parse_hex("95949f757db1f57ca94a5dff23314accbe7abee89597bf6a3c7382c84d7eb832"));
+
+    const auto transaction = signer.build();
+    ASSERT_EQ(hex(transaction), "cc01"
+        "f0625dee"
+        "0a4e"
+            "2a2c87fa"
+            "0a23""0a1440c2979694bbc961023d1d27be6fc4d21a9febe6120b0a03424e4210c098a8dd03"
+            "1223""0a1488b37d5e05f3699e2a1406468e5d87cb9dcceb95120b0a03424e4210c098a8dd03"
+        "126e"
+            "0a26"
+            "eb5ae987"
+            "21026a35920088d98c3888ca68c53dfc93f4564602606cbb87f0fe5ee533db38e502"
+            "1240""c65a13440f18a155bd971ee40b9e0dd58586f5bf344e12ec4c76c439aebca8c7789bab7bfbfb4ce89aadc4a02df225b6b6efc861c13bbeb5f7a3eea2d7ffc80f"
+            "1813"
+            "2017"
+        "1a04""74657374"
+        "2001"
+    );
+}
+
+TEST(Messages, SignMalformedOrder) {
+    auto encoded = Messages::encodeOrder(messagesNewOrder());
+    encoded[0] ^= 1;
+    auto signer = Signer(encoded);
+    signer.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
+    ASSERT_TRUE(signer.build().empty());
+    ASSERT_TRUE(signer.sign().isZero());
+    Arena arena;
+    ASSERT_TRUE(signer.build(arena).empty());
+}
+
+} // namespace
@@ -0,0 +1,137 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Decoder.h"
+#include "HexCoding.h"
+#include "OrderScheduler.h"
+#include "Verifier.h"
+
+#include "dex.pb.h"
+
+#include <gtest/gtest.h>
+
+namespace Binance {
+
+static const auto privateKey = parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9");
+
+static NewOrder makeOrder(int index) {
+    auto order = NewOrder();
+    auto keyhash = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+    order.set_sender(keyhash.data(), keyhash.size());
+    order.set_id("B6561DCC104130059A7C08F48C64610C1F6F9064-" + std::to_string(index));
+    order.set_symbol("BTC-5C4_BNB");
+    order.set_ordertype(2);
+    order.set_side(1);
+    order.set_price(100000000);
+    order.set_quantity(1200000000);
+    order.set_timeinforce(1);
+    return order;
+}
+
+static Transaction decode(const Data& data) {
+    // Skip the two byte length prefix and the type prefix.
+    auto transaction = Transaction();
+    transaction.ParseFromArray(data.data() + 2 + 4, static_cast<int>(data.size() - 2 - 4));
+    return transaction;
+}
+
+TEST(OrderScheduler, CoalescesOrders) {
+    AccountRegistry accounts;
+    OrderScheduler scheduler(accounts, "chain-bnb", std::chrono::seconds(10));
+    scheduler.addAccount("main", privateKey, 1, 10);
+
+    auto first = scheduler.submit("main", makeOrder(1));
+    auto second = scheduler.submit("main", makeOrder(2));
+    auto third = scheduler.submit("main", makeOrder(3));
+    scheduler.flush();
+
+    auto transaction = first.get();
+    ASSERT_FALSE(transaction.empty());
+    ASSERT_EQ(second.get(), transaction);
+    ASSERT_EQ(third.get(), transaction);
+    ASSERT_EQ(decode(transaction).msgs_size(), 3);
+    ASSERT_EQ(scheduler.sequence("main"), 11);
+    ASSERT_EQ(accounts.find("main")->sequence(), 11);
+
+    auto metrics = scheduler.metrics();
+    ASSERT_EQ(metrics.orders, 3);
+    ASSERT_EQ(metrics.transactions, 1);
+    ASSERT_EQ(metrics.signaturesSaved(), 2);
+    ASSERT_EQ(metrics.batchSize[2], 1);
+
+    ASSERT_THROW(scheduler.submit("other", makeOrder(4)), std::invalid_argument);
+}
+
+TEST(OrderScheduler, CancelsPreemptOrders) {
+    AccountRegistry accounts;
+    accounts.add("main", privateKey, 1, 10);
+    OrderScheduler scheduler(accounts, "chain-bnb", std::chrono::seconds(10));
+
+    auto order = scheduler.submit("main", makeOrder(1));
+    auto cancelOrder = CancelOrder();
+    cancelOrder.set_symbol("BTC-5C4_BNB");
+    cancelOrder.set_refid("B6561DCC104130059A7C08F48C64610C1F6F9064-0");
+    auto cancel = scheduler.submit("main", cancelOrder);
+
+    auto transaction = cancel.get();
+    ASSERT_EQ(order.get(), transaction);
+    auto decoded = decode(transaction);
+    ASSERT_EQ(decoded.msgs_size(), 2);
+    ASSERT_EQ(hex(decoded.msgs(0).substr(0, 4)), "166e681b");
+    ASSERT_EQ(hex(decoded.msgs(1).substr(0, 4)), "ce6dc043");
+}
+
+TEST(OrderScheduler, FlushesFullBatches) {
+    AccountRegistry accounts;
+    auto mainAccount = accounts.add("main", privateKey, 1, 10);
+    auto otherAccount = accounts.add("other", privateKey, 2, 0);
+    OrderScheduler scheduler(accounts, "chain-bnb", std::chrono::seconds(10), std::chrono::microseconds(0), 2);
+
+    auto first = scheduler.submit("main", makeOrder(1));
+    auto second = scheduler.submit("other", makeOrder(2));
+    ASSERT_NE(first.get(), second.get());
+    ASSERT_EQ(mainAccount->sequence(), 11);
+    ASSERT_EQ(otherAccount->sequence(), 1);
+}
+
+TEST(OrderScheduler, ReservesOneSequencePerTransaction) {
+    AccountRegistry accounts;
+    auto account = accounts.add("main", privateKey, 1, 10);
+    OrderScheduler scheduler(accounts, "chain-bnb", std::chrono::seconds(10), std::chrono::microseconds(0), 3);
+
+    // Orders that don't fit in a transaction fail without taking a sequence number.
+    auto oversized = makeOrder(0);
+    oversized.set_id(std::string(TransactionBuilder::defaultMaxSize, 'A'));
+    auto rejected = scheduler.submit("main", oversized);
+    auto first = scheduler.submit("main", makeOrder(1));
+    auto second = scheduler.submit("main", makeOrder(2));
+    ASSERT_TRUE(rejected.get().empty());
+    const auto batch = first.get();
+    ASSERT_EQ(second.get(), batch);
+
+    auto third = scheduler.submit("main", makeOrder(3));
+    scheduler.flush();
+    const auto single = third.get();
+    ASSERT_EQ(account->sequence(), 12);
+    ASSERT_FALSE(account->needsResync());
+
+    auto sequence = int64_t(10);
+    for (const auto& transaction : { batch, single }) {
+        ASSERT_TRUE(verifyTransaction(transaction.data(), transaction.size()));
+        Amino::TransactionView view;
+        ASSERT_TRUE(Amino::decodeTransaction(transaction, view));
+        ASSERT_EQ(view.signatures.begin()->sequence, sequence);
+        sequence += 1;
+    }
+
+    auto metrics = scheduler.metrics();
+    ASSERT_EQ(metrics.orders, 3);
+    ASSERT_EQ(metrics.transactions, 2);
+    ASSERT_EQ(metrics.failed, 1);
+}
+
+} // namespace
@@ -0,0 +1,111 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HexCoding.h"
+#include "PayoutBuilder.h"
+
+#include "dex.pb.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+namespace Binance {
+
+static PayoutBuilder makeBuilder() {
+    auto builder = PayoutBuilder();
+    builder.accountNumber = 19;
+    builder.sequence = 23;
+    builder.privateKey = parse_hex("95949f757db1f57ca94a5dff23314accbe7abee89597bf6a3c7382c84d7eb832");
+    return builder;
+}
+
+static Data recipient(int index) {
+    auto address = parse_hex("88b37d5e05f3699e2a1406468e5d87cb9dcceb00");
+    address[19] = static_cast<byte>(index);
+    return address;
+}
+
+TEST(PayoutBuilder, Aggregates) {
+    auto builder = makeBuilder();
+    ASSERT_TRUE(builder.add(recipient(1), "BNB", 100));
+    ASSERT_TRUE(builder.add(recipient(2), "BNB", 200));
+    ASSERT_TRUE(builder.add(recipient(1), "ABC-123", 5));
+    ASSERT_TRUE(builder.add(recipient(1), "BNB", 50));
+    ASSERT_FALSE(builder.add(recipient(3), "BNB", 0));
+    ASSERT_EQ(builder.recipients(), 2);
+
+    auto messages = builder.pack();
+    ASSERT_EQ(messages.size(), 1);
+    auto& send = messages[0];
+
+    ASSERT_EQ(send.inputs_size(), 1);
+    ASSERT_EQ(hex(send.inputs(0).address()), "40c2979694bbc961023d1d27be6fc4d21a9febe6");
+    ASSERT_EQ(send.inputs(0).coins_size(), 2);
+    ASSERT_EQ(send.inputs(0).coins(0).denom(), "ABC-123");
+    ASSERT_EQ(send.inputs(0).coins(0).amount(), 5);
+    ASSERT_EQ(send.inputs(0).coins(1).denom(), "BNB");
+    ASSERT_EQ(send.inputs(0).coins(1).amount(), 350);
+
+    ASSERT_EQ(send.outputs_size(), 2);
+    ASSERT_EQ(hex(send.outputs(0).address()), hex(recipient(1)));
+    ASSERT_EQ(send.outputs(0).coins_size(), 2);
+    ASSERT_EQ(send.outputs(0).coins(1).amount(), 150);
+    ASSERT_EQ(send.outputs(1).coins(0).amount(), 200);
+}
+
+TEST(PayoutBuilder, PacksByOutputs) {
+    auto builder = makeBuilder();
+    builder.maxOutputs = 2;
+    builder.threads = 2;
+    for (int i = 0; i < 5; i += 1) {
+        ASSERT_TRUE(builder.add(recipient(i), "BNB", 1'000'000 + i));
+    }
+
+    auto messages = builder.pack();
+    ASSERT_EQ(messages.size(), 3);
+    ASSERT_EQ(messages[2].outputs_size(), 1);
+    ASSERT_EQ(messages[2].inputs(0).coins(0).amount(), 1'000'004);
+
+    auto transactions = builder.build();
+    ASSERT_EQ(transactions.size(), 3);
+    for (auto& transaction : transactions) {
+        ASSERT_FALSE(transaction.empty());
+    }
+}
+
+TEST(PayoutBuilder, PacksBySize) {
+    auto builder = makeBuilder();
+    for (int i = 0; i < 10; i += 1) {
+        ASSERT_TRUE(builder.add(recipient(i), "BNB", 1'000'000));
+    }
+
+    auto transactions = builder.build();
+    ASSERT_EQ(transactions.size(), 1);
+
+    builder.maxSize = transactions[0].size();
+    ASSERT_EQ(builder.build().size(), 1);
+
+    builder.maxSize = transactions[0].size() - 1;
+    auto split = builder.build();
+    ASSERT_EQ(split.size(), 2);
+    ASSERT_LE(split[0].size(), builder.maxSize);
+
+    builder.maxSize = 100;
+    ASSERT_THROW(builder.pack(), std::invalid_argument);
+}
+
+TEST(PayoutBuilder, BuildFailure) {
+    auto builder = makeBuilder();
+    ASSERT_TRUE(builder.build().empty());
+
+    ASSERT_TRUE(builder.add(recipient(1), "BNB", 1'000'000));
+    builder.memo = "\xff";
+    ASSERT_THROW(builder.build(), std::runtime_error);
+}
+
+} // namespace
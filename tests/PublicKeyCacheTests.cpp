@@ -0,0 +1,144 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HexCoding.h"
+#include "PublicKeyCache.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/secp256k1.h"
+#include "crypto/sha2.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace Binance {
+
+struct SignedMessage {
+    Data publicKey = Data(33);
+    uint8_t signature[64];
+    uint8_t digest[32];
+};
+
+static SignedMessage makeSignedMessage(int key, int message) {
+    const auto seed = std::to_string(key);
+    uint8_t privateKey[32];
+    sha256_Raw(reinterpret_cast<const uint8_t*>(seed.data()), seed.size(), privateKey);
+    const auto text = std::to_string(message);
+    SignedMessage signed_;
+    sha256_Raw(reinterpret_cast<const uint8_t*>(text.data()), text.size(), signed_.digest);
+    ecdsa_get_public_key33(&secp256k1, privateKey, signed_.publicKey.data());
+    ecdsa_sign_digest(&secp256k1, privateKey, signed_.digest, signed_.signature, nullptr, nullptr);
+    return signed_;
+}
+
+TEST(PublicKeyCache, Find) {
+    auto cache = PublicKeyCache(16);
+    const auto publicKey = parse_hex("029729a52e4e3c2b4a4e52aa74033eedaf8ba1df5ab6d1f518fd69e67bbd309b0e");
+    curve_point expected, point;
+    ASSERT_TRUE(ecdsa_read_pubkey(&secp256k1, publicKey.data(), &expected));
+    ASSERT_TRUE(cache.find(publicKey.data(), point));
+    ASSERT_TRUE(point_is_equal(&point, &expected));
+    ASSERT_TRUE(cache.find(publicKey.data(), point));
+    ASSERT_TRUE(point_is_equal(&point, &expected));
+
+    // Not on the curve, and an uncompressed prefix.
+    auto invalid = publicKey;
+    invalid[32] ^= 1;
+    ASSERT_FALSE(cache.find(invalid.data(), point));
+    invalid = publicKey;
+    invalid[0] = 0x04;
+    ASSERT_FALSE(cache.find(invalid.data(), point));
+
+    const auto stats = cache.stats();
+    ASSERT_EQ(stats.hits, 1);
+    ASSERT_EQ(stats.misses, 3);
+    ASSERT_EQ(stats.invalid, 2);
+    ASSERT_EQ(stats.size, 1);
+}
+
+TEST(PublicKeyCache, Verify) {
+    for (auto tables : {false, true}) {
+        auto cache = PublicKeyCache(16, tables);
+        for (int i = 0; i < 32; i += 1) {
+            auto entry = makeSignedMessage(i % 4, i);
+            ASSERT_TRUE(cache.verify(entry.publicKey.data(), entry.signature, entry.digest));
+            entry.digest[i % 32] ^= 1;
+            ASSERT_FALSE(cache.verify(entry.publicKey.data(), entry.signature, entry.digest));
+        }
+        ASSERT_EQ(cache.stats().misses, 4);
+        ASSERT_EQ(cache.stats().hits, 60);
+    }
+}
+
+TEST(PublicKeyCache, MatchesVerifyDigest) {
+    for (int i = 0; i < 64; i += 1) {
+        auto entry = makeSignedMessage(i, i);
+        curve_point point;
+        curve_point table[8];
+        ASSERT_TRUE(ecdsa_read_pubkey(&secp256k1, entry.publicKey.data(), &point));
+        ecdsa_point_table(&secp256k1, &point, table);
+        if (i % 2 == 1) {
+            entry.signature[i % 64] ^= 1;
+        }
+        const auto expected = ecdsa_verify_digest(&secp256k1, entry.publicKey.data(), entry.signature, entry.digest) == 0;
+        ASSERT_EQ(ecdsa_verify_digest_point(&secp256k1, &point, entry.signature, entry.digest) == 0, expected);
+        ASSERT_EQ(ecdsa_verify_digest_table(&secp256k1, table, entry.signature, entry.digest) == 0, expected);
+    }
+}
+
+TEST(PublicKeyCache, ClockEviction) {
+    std::vector<Data> keys;
+    for (int i = 0; i < 3; i += 1) {
+        keys.push_back(makeSignedMessage(i, 0).publicKey);
+    }
+    auto cache = PublicKeyCache(2, false, 1);
+    ASSERT_EQ(cache.prewarm({keys[0], keys[1], Data(33)}), 2);
+    ASSERT_EQ(cache.stats().invalid, 1);
+
+    // The first key is referenced, so the sweep passes over it and evicts the second.
+    curve_point point;
+    ASSERT_TRUE(cache.find(keys[0].data(), point));
+    ASSERT_TRUE(cache.find(keys[2].data(), point));
+    ASSERT_EQ(cache.stats().evictions, 1);
+
+    const auto misses = cache.stats().misses;
+    ASSERT_TRUE(cache.find(keys[0].data(), point));
+    ASSERT_EQ(cache.stats().misses, misses);
+    ASSERT_TRUE(cache.find(keys[1].data(), point));
+    ASSERT_EQ(cache.stats().misses, misses + 1);
+
+    cache.clear();
+    ASSERT_EQ(cache.stats().size, 0);
+}
+
+TEST(PublicKeyCache, Concurrent) {
+    std::vector<SignedMessage> entries;
+    for (int i = 0; i < 8; i += 1) {
+        entries.push_back(makeSignedMessage(i, i));
+    }
+    auto cache = PublicKeyCache(4, true, 2);
+    std::vector<std::thread> pool;
+    for (int i = 0; i < 4; i += 1) {
+        pool.emplace_back([&]() {
+            for (int round = 0; round < 4; round += 1) {
+                for (const auto& entry : entries) {
+                    EXPECT_TRUE(cache.verify(entry.publicKey.data(), entry.signature, entry.digest));
+                }
+            }
+        });
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    const auto stats = cache.stats();
+    ASSERT_EQ(stats.hits + stats.misses, 4 * 4 * entries.size());
+    ASSERT_LE(stats.size, 4);
+}
+
+} // namespace
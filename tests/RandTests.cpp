@@ -0,0 +1,57 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Data.h"
+#include "HexCoding.h"
+
+#include "crypto/rand.h"
+
+#include <gtest/gtest.h>
+
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+namespace Binance {
+
+TEST(Rand, ThreadsDrawDifferentBytes) {
+    auto first = Data(32);
+    auto second = Data(32);
+    random_buffer(first.data(), first.size());
+    std::thread([&second]() { random_buffer(second.data(), second.size()); }).join();
+    ASSERT_NE(hex(first), hex(second));
+    ASSERT_NE(hex(first), hex(Data(32)));
+}
+
+TEST(Rand, ForkedChildDoesNotRepeatParent) {
+    // Leave unread bytes in this thread's block for the child to inherit.
+    random32();
+
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    const auto pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        auto bytes = Data(32);
+        random_buffer(bytes.data(), bytes.size());
+        const auto written = write(fds[1], bytes.data(), bytes.size());
+        _exit(written == static_cast<ssize_t>(bytes.size()) ? 0 : 1);
+    }
+    close(fds[1]);
+
+    auto child = Data(32);
+    ASSERT_EQ(read(fds[0], child.data(), child.size()), static_cast<ssize_t>(child.size()));
+    close(fds[0]);
+    int status;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+
+    auto parent = Data(32);
+    random_buffer(parent.data(), parent.size());
+    ASSERT_NE(hex(child), hex(parent));
+}
+
+} // namespace
@@ -0,0 +1,91 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HexCoding.h"
+#include "Messages.h"
+#include "Recovery.h"
+#include "Signer.h"
+#include "Verifier.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/secp256k1.h"
+#include "crypto/sha2.h"
+
+#include <gtest/gtest.h>
+
+namespace Binance {
+
+TEST(Recovery, SignerRecoveryId) {
+    auto order = Messages::NewOrder();
+    order.sender = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+    order.id = "B6561DCC104130059A7C08F48C64610C1F6F9064-11";
+    order.symbol = "BTC-5C4_BNB";
+    order.ordertype = 2;
+    order.side = 1;
+    order.price = 100000000;
+    order.quantity = 1200000000;
+    order.timeinforce = 1;
+
+    const auto encoded = Messages::encodeOrder(order);
+    auto signer = Signer(encoded);
+    signer.accountNumber = 1;
+    signer.sequence = 10;
+    signer.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
+
+    uint8_t recoveryId = 0xFF;
+    const auto signature = signer.sign(&recoveryId);
+    ASSERT_LT(recoveryId, 4);
+    ASSERT_EQ(signature, signer.sign());
+
+    const auto transaction = signer.build();
+    Amino::TransactionView view;
+    ASSERT_TRUE(Amino::decodeTransaction(transaction, view));
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    ASSERT_TRUE(preimageDigest(view, *view.signatures.begin(), signer.chainId, digest));
+    const auto publicKey = recoverPublicKey(signature.data(), digest, recoveryId);
+    ASSERT_EQ(hex(publicKey), "029729a52e4e3c2b4a4e52aa74033eedaf8ba1df5ab6d1f518fd69e67bbd309b0e");
+}
+
+TEST(Recovery, BatchMatchesSingle) {
+    const size_t count = 300;
+    Data signatures(count * 64);
+    Data digests(count * 32);
+    Data recoveryIds(count);
+    Data expected(count * 33);
+    for (size_t i = 0; i < count; i += 1) {
+        const auto seed = std::to_string(i);
+        uint8_t privateKey[SHA256_DIGEST_LENGTH];
+        sha256_Raw(reinterpret_cast<const uint8_t*>(seed.data()), seed.size(), privateKey);
+        sha256_Raw(privateKey, sizeof(privateKey), &digests[32 * i]);
+        ASSERT_EQ(ecdsa_sign_digest(&secp256k1, privateKey, &digests[32 * i], &signatures[64 * i], &recoveryIds[i], nullptr), 0);
+        ecdsa_get_public_key33(&secp256k1, privateKey, &expected[33 * i]);
+    }
+
+    // A zero r, an out of range recovery id and a wrong recovery id.
+    std::fill(&signatures[64 * 7], &signatures[64 * 7 + 32], 0);
+    recoveryIds[8] = 4;
+    recoveryIds[9] ^= 1;
+
+    Data publicKeys(count * 33);
+    std::unique_ptr<bool[]> results(new bool[count]);
+    ASSERT_EQ(recoverPublicKeys(signatures.data(), digests.data(), recoveryIds.data(), count, publicKeys.data(), results.get(), 3), count - 2);
+    for (size_t i = 0; i < count; i += 1) {
+        const auto single = recoverPublicKey(&signatures[64 * i], &digests[32 * i], recoveryIds[i]);
+        ASSERT_EQ(results[i], !single.empty()) << i;
+        if (results[i]) {
+            ASSERT_EQ(hex(&publicKeys[33 * i], &publicKeys[33 * i + 33]), hex(single)) << i;
+        }
+        if (i != 7 && i != 8 && i != 9) {
+            ASSERT_EQ(hex(single), hex(&expected[33 * i], &expected[33 * i + 33])) << i;
+        }
+    }
+    ASSERT_FALSE(results[7]);
+    ASSERT_FALSE(results[8]);
+    ASSERT_TRUE(results[9]);
+}
+
+} // namespace
@@ -0,0 +1,136 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HexCoding.h"
+#include "Messages.h"
+#include "SignatureCache.h"
+#include "Signer.h"
+#include "Verifier.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/secp256k1.h"
+#include "crypto/sha2.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace Binance {
+
+struct SignedDigest {
+    uint8_t publicKey[33];
+    uint8_t signature[64];
+    uint8_t digest[32];
+};
+
+static SignedDigest makeSignedDigest(int index) {
+    const auto privateKey = parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9");
+    const auto message = std::to_string(index);
+    SignedDigest signed_;
+    sha256_Raw(reinterpret_cast<const uint8_t*>(message.data()), message.size(), signed_.digest);
+    ecdsa_get_public_key33(&secp256k1, privateKey.data(), signed_.publicKey);
+    ecdsa_sign_digest(&secp256k1, privateKey.data(), signed_.digest, signed_.signature, nullptr, nullptr);
+    return signed_;
+}
+
+TEST(SignatureCache, CachesValidSignatures) {
+    auto cache = SignatureCache(100);
+    auto entry = makeSignedDigest(1);
+    ASSERT_TRUE(cache.verify(entry.publicKey, entry.signature, entry.digest));
+    ASSERT_TRUE(cache.verify(entry.publicKey, entry.signature, entry.digest));
+
+    // A different digest with the same signature misses and is rejected, and isn't cached.
+    entry.digest[0] ^= 1;
+    ASSERT_FALSE(cache.verify(entry.publicKey, entry.signature, entry.digest));
+    ASSERT_FALSE(cache.contains(entry.publicKey, entry.signature, entry.digest));
+
+    const auto stats = cache.stats();
+    ASSERT_EQ(stats.hits, 1);
+    ASSERT_EQ(stats.misses, 3);
+    ASSERT_EQ(stats.insertions, 1);
+    ASSERT_EQ(stats.size, 1);
+
+    cache.clear();
+    entry.digest[0] ^= 1;
+    ASSERT_FALSE(cache.contains(entry.publicKey, entry.signature, entry.digest));
+}
+
+TEST(SignatureCache, Eviction) {
+    std::vector<SignedDigest> entries;
+    for (int i = 0; i < 3; i += 1) {
+        entries.push_back(makeSignedDigest(i));
+    }
+
+    auto lru = SignatureCache(2, 1, SignatureCache::Eviction::lru);
+    auto fifo = SignatureCache(2, 1, SignatureCache::Eviction::fifo);
+    for (auto cache : {&lru, &fifo}) {
+        cache->insert(entries[0].publicKey, entries[0].signature, entries[0].digest);
+        cache->insert(entries[1].publicKey, entries[1].signature, entries[1].digest);
+        ASSERT_TRUE(cache->contains(entries[0].publicKey, entries[0].signature, entries[0].digest));
+        cache->insert(entries[2].publicKey, entries[2].signature, entries[2].digest);
+        ASSERT_EQ(cache->stats().evictions, 1);
+        ASSERT_EQ(cache->stats().size, 2);
+    }
+
+    // The lookup refreshed the first entry in the LRU cache only.
+    ASSERT_TRUE(lru.contains(entries[0].publicKey, entries[0].signature, entries[0].digest));
+    ASSERT_FALSE(lru.contains(entries[1].publicKey, entries[1].signature, entries[1].digest));
+    ASSERT_FALSE(fifo.contains(entries[0].publicKey, entries[0].signature, entries[0].digest));
+    ASSERT_TRUE(fifo.contains(entries[1].publicKey, entries[1].signature, entries[1].digest));
+}
+
+TEST(SignatureCache, ConcurrentVerification) {
+    std::vector<SignedDigest> entries;
+    for (int i = 0; i < 16; i += 1) {
+        entries.push_back(makeSignedDigest(i));
+    }
+
+    auto cache = SignatureCache(64, 4);
+    std::vector<std::thread> pool;
+    for (int i = 0; i < 4; i += 1) {
+        pool.emplace_back([&]() {
+            for (int round = 0; round < 4; round += 1) {
+                for (const auto& entry : entries) {
+                    EXPECT_TRUE(cache.verify(entry.publicKey, entry.signature, entry.digest));
+                }
+            }
+        });
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    const auto stats = cache.stats();
+    ASSERT_EQ(stats.hits + stats.misses, 4 * 4 * entries.size());
+    ASSERT_EQ(stats.size, entries.size());
+    ASSERT_GE(stats.hits, 3 * 4 * entries.size());
+}
+
+TEST(SignatureCache, Verifier) {
+    auto order = Messages::NewOrder();
+    order.sender = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+    order.id = "B6561DCC104130059A7C08F48C64610C1F6F9064-11";
+    order.symbol = "BTC-5C4_BNB";
+    order.price = 100000000;
+    order.quantity = 1200000000;
+    const auto encoded = Messages::encodeOrder(order);
+    auto signer = Signer(encoded);
+    signer.accountNumber = 1;
+    signer.sequence = 10;
+    signer.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
+    const auto transaction = signer.build();
+
+    auto cache = SignatureCache(16);
+    ASSERT_TRUE(verifyTransaction(transaction.data(), transaction.size(), "chain-bnb", &cache));
+    ASSERT_TRUE(verifyTransaction(transaction.data(), transaction.size(), "chain-bnb", &cache));
+    ASSERT_FALSE(verifyTransaction(transaction.data(), transaction.size(), "other-chain", &cache));
+    ASSERT_EQ(cache.stats().hits, 1);
+    ASSERT_EQ(cache.stats().size, 1);
+}
+
+} // namespace
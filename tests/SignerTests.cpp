@@ -13,6 +13,9 @@
 
 #include <gtest/gtest.h>
 
+#include <map>
+#include <string>
+
 namespace Binance {
 
 TEST(BinanceSigner, Sign) {
@@ -37,7 +40,7 @@ TEST(BinanceSigner, Sign) {
     signer.sequence = 35;
     signer.source = 1;
 
-    signer.privateKey = parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9");
+    signer.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
 
     auto signature = signer.sign();
 
@@ -61,7 +64,7 @@ TEST(BinanceSigner, Build) {
     signer.chainId = "chain-bnb";
     signer.accountNumber = 1;
     signer.sequence = 10;
-    signer.privateKey = parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9");
+    signer.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
 
     auto result = signer.build();
 
@@ -114,7 +117,7 @@ TEST(BinanceSigner, BuildSend) {
     signer.sequence = 23;
     signer.memo = "test";
     signer.source = 1;
-    signer.privateKey = parse_hex("95949f757db1f57ca94a5dff23314accbe7abee89597bf6a3c7382c84d7eb832");
+    signer.privateKey = PrivateKey(parse_hex("95949f757db1f57ca94a5dff23314accbe7abee89597bf6a3c7382c84d7eb832"));
 
     auto result = signer.build();
 
@@ -136,4 +139,93 @@ TEST(BinanceSigner, BuildSend) {
     );
 }
 
+TEST(BinanceSigner, BuildIntoBuffer) {
+    auto order = CancelOrder();
+    order.set_symbol("BTC-5C4_BNB");
+    order.set_refid("B6561DCC104130059A7C08F48C64610C1F6F9064-10");
+    auto signer = Signer(order);
+    signer.privateKey = PrivateKey(parse_hex("95949f757db1f57ca94a5dff23314accbe7abee89597bf6a3c7382c84d7eb832"));
+
+    // Transactions the protobuf serializer produced before transactions were sized up front, up to the memo bytes.
+    const auto golden = std::map<int, std::string>{
+        {127, "b502"
+            "f0625dee"
+            "0a3e"
+                "166e681b"
+                "120b""4254432d3543345f424e42"
+                "1a2b""423635363144434331303431333030353941374330384634384336343631304331463646393036342d3130"
+            "126e"
+                "0a26""eb5ae987""21026a35920088d98c3888ca68c53dfc93f4564602606cbb87f0fe5ee533db38e502"
+                "1240""599e9ed740c348576f63c21bd93f56dd332fa44f3587ad8c41bebc7b8bd8fe8302f2454ef00052740d6248e5fda3d5ce8ec2604ac292128130652b76bb12f10b"
+                "2098e007"
+            "1a7f"},
+        {128, "b702"
+            "f0625dee"
+            "0a3e"
+                "166e681b"
+                "120b""4254432d3543345f424e42"
+                "1a2b""423635363144434331303431333030353941374330384634384336343631304331463646393036342d3130"
+            "126e"
+                "0a26""eb5ae987""21026a35920088d98c3888ca68c53dfc93f4564602606cbb87f0fe5ee533db38e502"
+                "1240""9067486debcaef5974aaa9e46e536824f8b81c7afe73bccf86c428c087f5f80d4a5dbacf9d99dff6d3a40beb5cf6da01a163a2919e0ea9a2f8191cd8fa1eced5"
+                "2080e807"
+            "1a8001"},
+        {300, "e303"
+            "f0625dee"
+            "0a3e"
+                "166e681b"
+                "120b""4254432d3543345f424e42"
+                "1a2b""423635363144434331303431333030353941374330384634384336343631304331463646393036342d3130"
+            "126e"
+                "0a26""eb5ae987""21026a35920088d98c3888ca68c53dfc93f4564602606cbb87f0fe5ee533db38e502"
+                "1240""7f2309c8f5fd342df96d6c7f97a34bf32f5d5e0d771c38a753d17a163c9d30a228de3f7c04cafadb76d0fa0d1b382b3f181bc1d146705bb11745e683eb2d459d"
+                "20e0a712"
+            "1aac02"},
+    };
+
+    // Sizes straddling the one and two byte varints of the length prefix and the fields.
+    for (const auto memoSize : {0, 1, 8, 127, 128, 300}) {
+        signer.memo = std::string(memoSize, 'm');
+        signer.sequence = memoSize * 1000;
+        const auto expected = signer.build();
+        ASSERT_EQ(signer.encodedSize(), expected.size());
+        const auto it = golden.find(memoSize);
+        if (it != golden.end()) {
+            ASSERT_EQ(hex(expected), it->second + hex(signer.memo)) << memoSize;
+        }
+
+        auto buffer = Data(expected.size() + 10, 0xA5);
+        const auto transaction = signer.build(buffer);
+        ASSERT_EQ(transaction.data(), buffer.data());
+        ASSERT_EQ(hex(transaction), hex(expected));
+        ASSERT_EQ(buffer.back(), 0xA5);
+
+        auto small = Data(expected.size() - 1);
+        ASSERT_TRUE(signer.build(small).empty());
+    }
+
+    // Unsupported order types have no size.
+    auto signature = Signature();
+    ASSERT_EQ(Signer(signature).encodedSize(), 0);
+    ASSERT_TRUE(Signer(signature).build().empty());
+}
+
+TEST(BinanceSigner, InvalidText) {
+    auto order = CancelOrder();
+    order.set_symbol("BTC-5C4_BNB");
+    order.set_refid("B6561DCC104130059A7C08F48C64610C1F6F9064-10");
+    auto signer = Signer(order);
+    signer.privateKey = PrivateKey(parse_hex("95949f757db1f57ca94a5dff23314accbe7abee89597bf6a3c7382c84d7eb832"));
+    ASSERT_FALSE(signer.sign().isZero());
+
+    // Invalid UTF-8 fails both calls the same way, without throwing.
+    signer.memo = "\xff";
+    ASSERT_TRUE(signer.sign().isZero());
+    ASSERT_TRUE(signer.build().empty());
+    signer.memo.clear();
+    order.set_symbol("\xc3");
+    ASSERT_TRUE(signer.sign().isZero());
+    ASSERT_TRUE(signer.build().empty());
+}
+
 } // namespace
@@ -0,0 +1,116 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HexCoding.h"
+#include "Signer.h"
+#include "SigningService.h"
+
+#include "dex.pb.h"
+
+#include <gtest/gtest.h>
+
+namespace Binance {
+
+static const auto privateKey = parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9");
+
+static NewOrder makeOrder(int index) {
+    auto order = NewOrder();
+    auto keyhash = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+    order.set_sender(keyhash.data(), keyhash.size());
+    order.set_id("B6561DCC104130059A7C08F48C64610C1F6F9064-" + std::to_string(index));
+    order.set_symbol("BTC-5C4_BNB");
+    order.set_ordertype(2);
+    order.set_side(1);
+    order.set_price(100000000);
+    order.set_quantity(1200000000);
+    order.set_timeinforce(1);
+    return order;
+}
+
+TEST(SigningService, MatchesSigner) {
+    AccountRegistry accounts;
+    auto account = accounts.add("main", privateKey, 1, 10);
+    SigningService service(accounts, "chain-bnb", 4);
+    ASSERT_EQ(service.threads(), 4);
+
+    std::vector<std::future<Data>> futures;
+    for (int i = 0; i < 64; i += 1) {
+        futures.push_back(service.submit("main", makeOrder(i)));
+    }
+    for (int i = 0; i < 64; i += 1) {
+        const auto order = makeOrder(i);
+        auto signer = Signer(order);
+        signer.accountNumber = 1;
+        signer.sequence = 10 + i;
+        signer.privateKey = PrivateKey(privateKey);
+        ASSERT_EQ(hex(futures[i].get()), hex(signer.build()));
+    }
+    ASSERT_EQ(account->sequence(), 74);
+
+    auto metrics = service.metrics();
+    ASSERT_EQ(metrics.completed, 64);
+    ASSERT_EQ(metrics.failed, 0);
+    ASSERT_LE(metrics.signing.p50, metrics.signing.p99);
+    ASSERT_LE(metrics.signing.p99, metrics.signing.max);
+    ASSERT_LE(metrics.signing.max, metrics.total.max);
+}
+
+TEST(SigningService, Callbacks) {
+    AccountRegistry accounts;
+    accounts.add("main", privateKey, 1, 0);
+    accounts.add("other", privateKey, 2, 0);
+
+    std::atomic<int> count{0};
+    {
+        SigningService service(accounts);
+        for (int i = 0; i < 16; i += 1) {
+            service.submit(i % 2 ? "main" : "other", makeOrder(i), [&count](Data transaction, SigningService::Status status) {
+                if (!transaction.empty() && status == SigningService::Status::success) {
+                    count += 1;
+                }
+            });
+        }
+        ASSERT_THROW(service.submit("missing", makeOrder(0)), std::invalid_argument);
+    }
+    ASSERT_EQ(count, 16);
+}
+
+TEST(SigningService, ReleasesSequenceOnFailure) {
+    AccountRegistry accounts;
+    auto account = accounts.add("main", privateKey, 1, 10);
+    SigningService service(accounts, "chain-bnb", 1);
+
+    // Transactions are not orders and fail to sign.
+    ASSERT_TRUE(service.submit("main", Transaction()).get().empty());
+    ASSERT_EQ(account->sequence(), 10);
+    ASSERT_FALSE(account->needsResync());
+
+    // Hold the worker so the failing order is processed after a later number was reserved.
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    service.submit("main", makeOrder(1), [released](Data, SigningService::Status) { released.wait(); });
+    std::promise<SigningService::Status> failure;
+    auto failed = failure.get_future();
+    service.submit("main", Transaction(), [&failure](Data transaction, SigningService::Status status) {
+        failure.set_value(transaction.empty() ? status : SigningService::Status::success);
+    });
+    auto next = service.submit("main", makeOrder(2));
+    release.set_value();
+
+    ASSERT_EQ(failed.get(), SigningService::Status::resyncRequired);
+    ASSERT_FALSE(next.get().empty());
+    ASSERT_TRUE(account->needsResync());
+
+    auto metrics = service.metrics();
+    ASSERT_EQ(metrics.failed, 2);
+    ASSERT_EQ(metrics.resyncs, 1);
+
+    account->resync(12);
+    ASSERT_FALSE(account->needsResync());
+}
+
+} // namespace
@@ -0,0 +1,136 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "Address.h"
+#include "HexCoding.h"
+#include "Serialization.h"
+#include "Signer.h"
+#include "TransactionBuilder.h"
+#include "Verifier.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/secp256k1.h"
+#include "crypto/sha2.h"
+#include "dex.pb.h"
+
+#include <gtest/gtest.h>
+
+namespace Binance {
+
+static NewOrder makeOrder(int index) {
+    auto order = NewOrder();
+    auto keyhash = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+    order.set_sender(keyhash.data(), keyhash.size());
+    order.set_id("B6561DCC104130059A7C08F48C64610C1F6F9064-" + std::to_string(index));
+    order.set_symbol("BTC-5C4_BNB");
+    order.set_ordertype(2);
+    order.set_side(1);
+    order.set_price(100000000);
+    order.set_quantity(1200000000);
+    order.set_timeinforce(1);
+    return order;
+}
+
+static TransactionBuilder makeBuilder() {
+    auto builder = TransactionBuilder();
+    builder.chainId = "chain-bnb";
+    builder.accountNumber = 1;
+    builder.sequence = 10;
+    builder.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
+    return builder;
+}
+
+TEST(TransactionBuilder, SingleMessageMatchesSigner) {
+    auto order = makeOrder(11);
+
+    auto signer = Signer(order);
+    signer.chainId = "chain-bnb";
+    signer.accountNumber = 1;
+    signer.sequence = 10;
+    signer.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
+
+    auto builder = makeBuilder();
+    ASSERT_TRUE(builder.add(order));
+
+    auto expected = signer.build();
+    auto result = builder.build();
+    ASSERT_EQ(hex(result), hex(expected));
+    ASSERT_EQ(builder.encodedSize(), result.size());
+}
+
+TEST(TransactionBuilder, MultipleMessages) {
+    auto newOrder = makeOrder(12);
+    auto cancelOrder = CancelOrder();
+    cancelOrder.set_symbol("BTC-5C4_BNB");
+    cancelOrder.set_refid("B6561DCC104130059A7C08F48C64610C1F6F9064-11");
+
+    auto builder = makeBuilder();
+    builder.memo = "batch";
+    builder.source = 1;
+    ASSERT_TRUE(builder.add(newOrder));
+    ASSERT_TRUE(builder.add(cancelOrder));
+    ASSERT_EQ(builder.count(), 2);
+
+    auto result = builder.build();
+    ASSERT_EQ(builder.encodedSize(), result.size());
+
+    // Strip the length prefix and type prefix and decode the transaction.
+    auto transaction = Transaction();
+    ASSERT_TRUE(transaction.ParseFromArray(result.data() + 2 + 4, static_cast<int>(result.size() - 2 - 4)));
+    ASSERT_EQ(transaction.msgs_size(), 2);
+    ASSERT_EQ(transaction.signatures_size(), 1);
+    ASSERT_EQ(hex(transaction.msgs(0).substr(0, 4)), "ce6dc043");
+    ASSERT_EQ(hex(transaction.msgs(1).substr(0, 4)), "166e681b");
+    ASSERT_EQ(transaction.memo(), "batch");
+
+    const auto preImage = signaturePreimage(builder);
+    ASSERT_NE(preImage.find("\"msgs\":[{"), std::string::npos);
+    ASSERT_NE(preImage.find("},{\"refid\""), std::string::npos);
+
+    byte hash[SHA256_DIGEST_LENGTH];
+    sha256_Raw(reinterpret_cast<const byte*>(preImage.data()), preImage.size(), hash);
+    byte publicKey[33];
+    ecdsa_get_public_key33(&secp256k1, builder.privateKey.data(), publicKey);
+    auto signature = builder.sign();
+    ASSERT_EQ(ecdsa_verify_digest(&secp256k1, publicKey, signature.data(), hash), 0);
+}
+
+TEST(TransactionBuilder, Limits) {
+    auto first = makeOrder(1);
+    auto second = makeOrder(2);
+    auto third = makeOrder(3);
+
+    auto builder = makeBuilder();
+    ASSERT_TRUE(builder.build().empty());
+
+    builder.maxMessages = 2;
+    ASSERT_TRUE(builder.add(first));
+    ASSERT_TRUE(builder.add(second));
+    ASSERT_FALSE(builder.add(third));
+
+    builder.clear();
+    builder.maxMessages = TransactionBuilder::defaultMaxMessages;
+    ASSERT_TRUE(builder.add(first));
+    builder.maxSize = builder.encodedSize();
+    ASSERT_FALSE(builder.add(second));
+    ASSERT_EQ(builder.count(), 1);
+}
+
+TEST(TransactionBuilder, SignsOrdersAsAdded) {
+    auto order = makeOrder(11);
+    auto builder = makeBuilder();
+    ASSERT_TRUE(builder.add(order));
+    const auto expected = builder.build();
+
+    // Changing the order after adding it does not change the signed transaction.
+    order.set_price(200000000);
+    const auto result = builder.build();
+    ASSERT_EQ(hex(result), hex(expected));
+    ASSERT_TRUE(verifyTransaction(result.data(), result.size()));
+}
+
+} // namespace
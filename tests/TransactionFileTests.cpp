@@ -0,0 +1,105 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HexCoding.h"
+#include "Messages.h"
+#include "Signer.h"
+#include "TransactionFile.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <system_error>
+
+namespace Binance {
+
+static Data buildTransaction(int64_t sequence) {
+    auto order = Messages::NewOrder();
+    order.sender = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+    order.id = "B6561DCC104130059A7C08F48C64610C1F6F9064-" + std::to_string(sequence);
+    order.symbol = "BTC-5C4_BNB";
+    order.ordertype = 2;
+    order.side = 1;
+    order.price = 100000000;
+    order.quantity = 1200000000;
+    order.timeinforce = 1;
+
+    const auto encoded = Messages::encodeOrder(order);
+    auto signer = Signer(encoded);
+    signer.accountNumber = 1;
+    signer.sequence = sequence;
+    signer.privateKey = PrivateKey(parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9"));
+    return signer.build();
+}
+
+static std::string writeFile(const std::string& name, const Data& contents) {
+    const auto path = testing::TempDir() + name;
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(contents.data()), contents.size());
+    return path;
+}
+
+TEST(TransactionFile, ProcessesChunks) {
+    Data contents;
+    for (int64_t i = 0; i < 100; i += 1) {
+        const auto transaction = buildTransaction(i);
+        contents.insert(contents.end(), transaction.begin(), transaction.end());
+    }
+    const auto path = writeFile("transactions.bin", contents);
+
+    {
+        auto reader = TransactionFileReader(path);
+        ASSERT_EQ(reader.data().size(), contents.size());
+
+        const auto chunks = reader.split(7);
+        ASSERT_EQ(chunks.size(), 7);
+        size_t frames = 0;
+        size_t bytes = 0;
+        for (const auto& chunk : chunks) {
+            auto frameReader = FrameReader(chunk);
+            ByteSpan frame;
+            while (frameReader.next(frame)) {
+                frames += 1;
+            }
+            ASSERT_FALSE(frameReader.failed());
+            bytes += chunk.size();
+        }
+        ASSERT_EQ(frames, 100);
+        ASSERT_EQ(bytes, contents.size());
+
+        std::atomic<int64_t> sequences{0};
+        const auto stats = reader.process(3, [&sequences](const Amino::TransactionView& transaction) {
+            sequences += transaction.signatures.begin()->sequence;
+        });
+        ASSERT_EQ(stats.transactions, 100);
+        ASSERT_EQ(stats.invalid, 0);
+        ASSERT_EQ(stats.bytes, contents.size());
+        ASSERT_EQ(sequences, 99 * 100 / 2);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(TransactionFile, TruncatedFrame) {
+    auto contents = buildTransaction(1);
+    const auto second = buildTransaction(2);
+    contents.insert(contents.end(), second.begin(), second.end() - 1);
+    const auto path = writeFile("truncated.bin", contents);
+
+    {
+        auto reader = TransactionFileReader(path);
+        const auto stats = reader.process(1, [](const Amino::TransactionView&) {});
+        ASSERT_EQ(stats.transactions, 1);
+        ASSERT_EQ(stats.invalid, 1);
+    }
+    std::remove(path.c_str());
+
+    ASSERT_THROW(TransactionFileReader(testing::TempDir() + "missing.bin"), std::system_error);
+}
+
+} // namespace
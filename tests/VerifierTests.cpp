@@ -0,0 +1,169 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HexCoding.h"
+#include "Messages.h"
+#include "Signer.h"
+#include "Verifier.h"
+#ifndef BINANCE_NO_PROTOBUF
+#include "Serialization.h"
+#include "TransactionBuilder.h"
+#endif
+
+#include "crypto/sha2.h"
+
+#include <gtest/gtest.h>
+
+namespace Binance {
+
+static const auto privateKey = parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9");
+
+static std::string decodedDigest(const Data& transaction, const std::string& chainId) {
+    Amino::TransactionView view;
+    EXPECT_TRUE(Amino::decodeTransaction(transaction, view));
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    EXPECT_TRUE(preimageDigest(view, *view.signatures.begin(), chainId, digest));
+    return hex(digest, digest + sizeof(digest));
+}
+
+#ifndef BINANCE_NO_PROTOBUF
+static std::string expectedDigest(const std::string& preimage) {
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256_Raw(reinterpret_cast<const uint8_t*>(preimage.data()), preimage.size(), digest);
+    return hex(digest, digest + sizeof(digest));
+}
+
+TEST(Verifier, MatchesSignaturePreimage) {
+    auto keyhash = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+    auto order = NewOrder();
+    order.set_sender(keyhash.data(), keyhash.size());
+    order.set_id("B6561DCC104130059A7C08F48C64610C1F6F9064-11");
+    order.set_symbol("BTC-5C4_BNB");
+    order.set_ordertype(1);
+    order.set_side(2);
+    order.set_price(-100000000);
+    order.set_quantity(1200000000);
+    order.set_timeinforce(3);
+
+    // Text that needs escaping.
+    auto cancel = CancelOrder();
+    cancel.set_symbol("quote\" backslash\\ tab\t nul\x01 \xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80 /");
+    cancel.set_refid("B6561DCC104130059A7C08F48C64610C1F6F9064-10");
+
+    auto freeze = TokenFreeze();
+    freeze.set_from(keyhash.data(), keyhash.size());
+    freeze.set_symbol("ABC-123");
+    freeze.set_amount(5);
+
+    auto unfreeze = TokenUnfreeze();
+    unfreeze.set_from(keyhash.data(), 1);
+    unfreeze.set_symbol("ABC-123");
+    unfreeze.set_amount(6);
+
+    auto builder = TransactionBuilder();
+    builder.chainId = "Binance-Chain-Tigris";
+    builder.accountNumber = 12;
+    builder.sequence = 35;
+    builder.source = 1;
+    builder.memo = "memo\n";
+    builder.privateKey = PrivateKey(privateKey);
+    builder.add(order);
+    builder.add(cancel);
+    builder.add(freeze);
+    builder.add(unfreeze);
+    const auto transaction = builder.build();
+
+    ASSERT_EQ(decodedDigest(transaction, builder.chainId), expectedDigest(signaturePreimage(builder)));
+    ASSERT_TRUE(verifyTransaction(transaction.data(), transaction.size(), builder.chainId));
+    ASSERT_FALSE(verifyTransaction(transaction.data(), transaction.size(), "chain-bnb"));
+}
+
+#endif
+
+TEST(Verifier, EscapedPreimage) {
+    auto cancel = Messages::CancelOrder();
+    cancel.symbol = "quote\" backslash\\ tab\t nul\x01 \xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80 /";
+    cancel.refid = "B6561DCC104130059A7C08F48C64610C1F6F9064-10";
+    const auto encoded = Messages::encodeOrder(cancel);
+    auto signer = Signer(encoded);
+    signer.chainId = "Binance-Chain-Tigris";
+    signer.accountNumber = 12;
+    signer.sequence = 35;
+    signer.source = 1;
+    signer.memo = "memo\n";
+    signer.privateKey = PrivateKey(privateKey);
+    const auto transaction = signer.build();
+
+    // SHA-256 of the JSON preimage from `signaturePreimage` for the same order.
+    ASSERT_EQ(decodedDigest(transaction, signer.chainId), "5dcbbf8c764429b6c042170b6ac6109b060babb527fd5df5e895b91072416ad7");
+    ASSERT_TRUE(verifyTransaction(transaction.data(), transaction.size(), signer.chainId));
+}
+
+TEST(Verifier, Send) {
+    auto order = Messages::Send();
+    order.inputs.push_back({parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064"), {{"ABC-123", 5}, {"BNB", 300}}});
+    order.outputs.push_back({parse_hex("88b37d5e05f3699e2a1406468e5d87cb9dcceb00"), {{"BNB", 100}}});
+    order.outputs.push_back({parse_hex("88b37d5e05f3699e2a1406468e5d87cb9dcceb01"), {{"ABC-123", 5}, {"BNB", 200}}});
+    const auto encoded = Messages::encodeOrder(order);
+    auto signer = Signer(encoded);
+    signer.privateKey = PrivateKey(privateKey);
+    signer.memo = "payout";
+    const auto transaction = signer.build();
+    ASSERT_TRUE(verifyTransaction(transaction.data(), transaction.size()));
+}
+
+TEST(Verifier, RejectsForgeries) {
+    auto order = Messages::NewOrder();
+    order.sender = parse_hex("b6561dcc104130059a7c08f48c64610c1f6f9064");
+    order.id = "B6561DCC104130059A7C08F48C64610C1F6F9064-11";
+    order.symbol = "BTC-5C4_BNB";
+    order.price = 100000000;
+    order.quantity = 1200000000;
+    const auto encoded = Messages::encodeOrder(order);
+    auto signer = Signer(encoded);
+    signer.accountNumber = 1;
+    signer.sequence = 10;
+    signer.privateKey = PrivateKey(privateKey);
+    const auto transaction = signer.build();
+
+    std::vector<Data> transactions(transaction.size() + 1, transaction);
+    std::vector<ByteSpan> spans;
+    for (size_t i = 0; i < transaction.size(); i += 1) {
+        // Flipping any bit after the length prefix breaks decoding or the signature.
+        if (i >= 2) {
+            transactions[i][i] ^= 0x01;
+        } else {
+            transactions[i].clear();
+        }
+        spans.emplace_back(transactions[i]);
+    }
+    spans.emplace_back(transactions.back());
+
+    std::unique_ptr<bool[]> results(new bool[spans.size()]);
+    ASSERT_EQ(verifyTransactions(spans.data(), spans.size(), results.get(), "chain-bnb", 3), 1);
+    ASSERT_TRUE(results[spans.size() - 1]);
+}
+
+TEST(Verifier, RejectsTrailingData) {
+    auto cancel = Messages::CancelOrder();
+    cancel.symbol = "BTC-5C4_BNB";
+    cancel.refid = "B6561DCC104130059A7C08F48C64610C1F6F9064-10";
+    const auto encoded = Messages::encodeOrder(cancel);
+    auto signer = Signer(encoded);
+    signer.privateKey = PrivateKey(privateKey);
+    const auto transaction = signer.build();
+    ASSERT_TRUE(verifyTransaction(transaction.data(), transaction.size()));
+
+    // The signatures don't cover bytes after the length-prefixed frame.
+    auto padded = transaction;
+    padded.push_back(0);
+    ASSERT_FALSE(verifyTransaction(padded.data(), padded.size()));
+    padded.insert(padded.end(), transaction.begin(), transaction.end());
+    ASSERT_FALSE(verifyTransaction(padded.data(), padded.size()));
+}
+
+} // namespace
@@ -0,0 +1,55 @@
+// Copyright © 2019 Binance.
+//
+// This file is part of the Binance Chain SDK. The full Binance Chain SDK
+// copyright notice, including terms governing use, modification, and
+// redistribution, is contained in the file LICENSE at the root of the source
+// code distribution tree.
+
+#include "HexCoding.h"
+
+#include "crypto/ecdsa.h"
+#include "crypto/secp256k1.h"
+#include "crypto/sha2.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+namespace Binance {
+
+using VerifyContext = std::unique_ptr<ecdsa_verify_ctx, decltype(&ecdsa_verify_ctx_free)>;
+
+TEST(VerifyContext, MatchesVerifyDigest) {
+    const auto privateKey = parse_hex("90335b9d2153ad1a9799a3ccc070bd64b4164e9642ee1dd48053c33f9a3a05e9");
+    uint8_t publicKey[33];
+    ecdsa_get_public_key33(&secp256k1, privateKey.data(), publicKey);
+    auto context = VerifyContext(ecdsa_verify_ctx_create(&secp256k1, publicKey), ecdsa_verify_ctx_free);
+    ASSERT_NE(context, nullptr);
+    ASSERT_EQ(ecdsa_verify_ctx_size(), 64 * sizeof(curve_point));
+
+    for (int i = 0; i < 64; i += 1) {
+        const auto message = std::to_string(i);
+        uint8_t digest[32];
+        uint8_t signature[64];
+        sha256_Raw(reinterpret_cast<const uint8_t*>(message.data()), message.size(), digest);
+        ASSERT_EQ(ecdsa_sign_digest(&secp256k1, privateKey.data(), digest, signature, nullptr, nullptr), 0);
+        ASSERT_EQ(ecdsa_verify_digest_with_ctx(&secp256k1, context.get(), signature, digest), 0);
+
+        // Tampered signatures and digests fail like they do with the generic path.
+        if (i % 2 == 0) {
+            signature[i % 64] ^= 0x80;
+        } else {
+            digest[i % 32] ^= 0x01;
+        }
+        ASSERT_NE(ecdsa_verify_digest(&secp256k1, publicKey, signature, digest), 0);
+        ASSERT_NE(ecdsa_verify_digest_with_ctx(&secp256k1, context.get(), signature, digest), 0);
+    }
+}
+
+TEST(VerifyContext, InvalidKey) {
+    auto publicKey = parse_hex("029729a52e4e3c2b4a4e52aa74033eedaf8ba1df5ab6d1f518fd69e67bbd309b0e");
+    publicKey[32] ^= 1;
+    ASSERT_EQ(ecdsa_verify_ctx_create(&secp256k1, publicKey.data()), nullptr);
+}
+
+} // namespace